@@ -0,0 +1,62 @@
+# Generates a C++ source holding files as constexpr byte arrays, for
+# EmbeddedResources. Run as a script at build time:
+#
+#   cmake -DSOURCE_DIR=<dir> -DOUTPUT=<file.cpp> -DFILES=<a|b|...> -P EmbedResources.cmake
+#
+# FILES are relative to SOURCE_DIR and become the embedded paths, so they must
+# match what the engine loads ("resources/shaders/Planet.vert"). '|' separates
+# them because a ';' list does not survive the custom command line.
+
+cmake_minimum_required(VERSION 3.15)
+
+string(REPLACE "|" ";" FILES "${FILES}")
+list(REMOVE_ITEM FILES "")
+# EmbeddedResources::Find binary-searches the table
+list(SORT FILES)
+
+# 16 bytes per line (CMake regexes have no {n})
+string(REPEAT "0x..," 16 LINE_PATTERN)
+
+set(ARRAYS "")
+set(TABLE "")
+set(INDEX 0)
+foreach(FILE_PATH IN LISTS FILES)
+    file(READ "${SOURCE_DIR}/${FILE_PATH}" HEX HEX)
+    string(LENGTH "${HEX}" HEX_LENGTH)
+    math(EXPR SIZE "${HEX_LENGTH} / 2")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${HEX}")
+    string(REGEX REPLACE "(${LINE_PATTERN})" "\\1\n            " BYTES "${BYTES}")
+    # A trailing 0 so text files can also be used as C strings
+    string(APPEND ARRAYS "        // ${FILE_PATH}\n        alignas(16) constexpr unsigned char File${INDEX}[] = {\n            ${BYTES}0x00\n        };\n\n")
+    string(APPEND TABLE "            { \"${FILE_PATH}\", File${INDEX}, ${SIZE} },\n")
+    math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+if(INDEX EQUAL 0)
+    # No zero-length arrays in C++
+    set(TABLE "            { {}, nullptr, 0 },\n")
+endif()
+
+set(SOURCE "// Generated by cmake/EmbedResources.cmake - do not edit
+#include <BunnyGL/Resources/EmbeddedResources.hpp>
+
+namespace BunnyGL {
+
+    namespace {
+
+${ARRAYS}        constexpr EmbeddedFile Files[] = {
+${TABLE}        };
+    }
+
+    const EmbeddedFile* EmbeddedResources::GetFiles() {
+        return Files;
+    }
+
+    size_t EmbeddedResources::GetCount() {
+        return ${INDEX};
+    }
+
+}
+")
+
+file(WRITE "${OUTPUT}" "${SOURCE}")
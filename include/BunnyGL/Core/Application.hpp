@@ -1,48 +1,146 @@
 #pragma once
 #include <BunnyGL/Core/Window.hpp>
+#include <BunnyGL/Core/FramePacer.hpp>
+#include <BunnyGL/Core/JobSystem.hpp>
+#include <BunnyGL/Renderer/CommandList.hpp>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 
 namespace BunnyGL {
     class Scene;
+    class RenderThread;
+
+    // CPU-side cost of the last frame, in milliseconds
+    struct FrameTimings {
+        uint32_t Frame = 0;         // Profiler frame number (matches GpuProfiler results)
+        double UpdateMs = 0.0;      // Scene update
+        double RenderMs = 0.0;      // Scene::OnRender command recording
+        double SwapMs = 0.0;        // Replay + SwapBuffers (or handing off to the render thread) + event polling
+        double TotalMs = 0.0;
+    };
+
+    struct ApplicationSpecification {
+        WindowSpecification Window;
+        uint64_t MaxFrames = 0;     // Stop after this many frames (0 = until the window closes)
+        uint32_t WorkerThreads = 0; // Job system workers (0 = hardware threads - 1)
+        // Replay GL commands on a dedicated thread, overlapping the next frame's update
+        bool UseRenderThread = false;
+        // Program binary cache (empty = disabled)
+        std::string ShaderCacheDirectory = "shadercache";
+        uint64_t ShaderCacheMaxBytes = 64ull * 1024 * 1024;
+        // Recompile shaders when their files change (see ResourceManager::SetShaderHotReload)
+        bool ShaderHotReload = false;
+        // Asynchronous asset loading (see AssetLoader): loader threads, and how
+        // much GL upload work each frame may take
+        uint32_t AssetLoaderThreads = 2;
+        double AssetUploadBudgetMs = 2.0;
+        uint64_t AssetUploadBudgetBytes = 8ull * 1024 * 1024;
+        // GPU memory for textures and meshes loaded from files; past it the
+        // least recently used are evicted and reloaded on demand (0 = unlimited)
+        uint64_t TextureMemoryBudget = 0;
+        uint64_t MeshMemoryBudget = 0;
+        // Packed resources (see PackArchive), read instead of loose files when
+        // the archive exists. Not mounted with ShaderHotReload, which watches
+        // the loose files. Empty = always read from disk.
+        std::string ResourceArchive = "resources.bgpak";
+        // Read files compiled into the binary (see EmbeddedResources) ahead of
+        // the archive and disk. Also off with ShaderHotReload.
+        bool UseEmbeddedResources = true;
+    };
 
     class Application {
     
     private:
+        static inline Application* s_Instance = nullptr;
+
+        std::unique_ptr<JobSystem> m_JobSystem;
         Window* m_Window;
+        std::unique_ptr<RenderThread> m_RenderThread;
+        CommandList m_CommandList;      // Single-threaded mode only
+        uint64_t m_MaxFrames = 0;
+        uint64_t m_FrameIndex = 0;
+        FrameTimings m_FrameTimings;
         std::unique_ptr<Scene> m_CurrentScene;
         bool m_Running = true;
-        // Simple time management
-        float m_LastFrameTime = 0.0f;
+        // Time management (double so precision holds over long uptimes)
+        double m_LastFrameTime = 0.0;
+        double m_FrameTime = 0.0;
+        double m_TotalTime = 0.0;
         float m_DeltaTime = 0.0f;
-        float m_TotalTime = 0.0f;
+        // Fixed-step simulation (m_FixedTimestep == 0 = variable step)
+        double m_FixedTimestep = 0.0;
+        double m_Accumulator = 0.0;
+        int m_MaxCatchUpSteps = 8;
+        float m_InterpolationAlpha = 1.0f;
         // FPS tracking
         int m_FrameCount = 0;
         float m_FPS = 0.0f;
-        float m_LastFPSCalcTime = 0.0f;
+        double m_LastFPSCalcTime = 0.0;
+        // Frame pacing
+        FramePacer m_FramePacer;
+        float m_TargetFPS = 0.0f;
+        bool m_VSync = false;
+        // Per-frame asset upload budget
+        double m_AssetUploadBudgetMs = 2.0;
+        uint64_t m_AssetUploadBudgetBytes = 0;
         
     public:
-        Application();
+        Application(const ApplicationSpecification& spec = ApplicationSpecification());
         virtual ~Application();
+
+        // The running application (one at a time)
+        static Application& Get() { return *s_Instance; }
         
         void Run();
+        void Close() { m_Running = false; }
+
+        // One frame with a fixed simulated delta instead of wall-clock time and
+        // without frame pacing (benchmarks, deterministic captures)
+        void Step(double deltaTime);
         
         // Scene management
         void SetScene(std::unique_ptr<Scene> scene);
         Scene* GetCurrentScene() { return m_CurrentScene.get(); }
         
-        // Simple FPS control
+        // Frame pacing (fps <= 0 = uncapped)
         void SetTargetFPS(float fps);
+        void SetVSync(bool enabled);
+        const FramePacingStats& GetFramePacingStats() const { return m_FramePacer.GetStats(); }
+        
+        // Fixed-step simulation: Scene::OnFixedUpdate runs at tickRate Hz, at most
+        // maxCatchUpSteps times per frame, and OnRender gets the interpolation alpha.
+        // tickRate <= 0 goes back to one variable OnUpdate per frame.
+        void SetFixedTimestep(double tickRate, int maxCatchUpSteps = 8);
+        double GetFixedTimestep() const { return m_FixedTimestep; }
+        
+        // Runs task where the GL context lives (the render thread, if enabled) and
+        // waits for it. Use for GL resource work outside OnAttach/OnDetach.
+        void ExecuteOnRenderThread(const std::function<void()>& task);
+        bool HasRenderThread() const { return m_RenderThread != nullptr; }
+
+        // Worker pool for scene code (OnUpdate etc.); see JobSystem
+        JobSystem& GetJobSystem() { return *m_JobSystem; }
         
         // Getters
         float GetDeltaTime() const { return m_DeltaTime; }
-        float GetTotalTime() const { return m_TotalTime; }
+        double GetTotalTime() const { return m_TotalTime; }
+        float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
         float GetFPS() const { return m_FPS; }
+        uint64_t GetFrameIndex() const { return m_FrameIndex; }
+        const FrameTimings& GetLastFrameTimings() const { return m_FrameTimings; }
+        bool IsHeadless() const { return m_Window->IsHeadless(); }
         
     protected:
         Window& GetWindow() { return *m_Window; }
         
     private:
         void UpdateTime();
+        void RunFrame();
+        void RenderFrame(const CommandList& commands, uint32_t frame);
+        void UpdateScene();
         void CalculateFPS();
+        void ApplyFramePacing();
     };
 }
\ No newline at end of file
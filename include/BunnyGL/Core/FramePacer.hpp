@@ -0,0 +1,63 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace BunnyGL {
+
+    enum class FramePacingMode {
+        Unlimited,  // No waiting at all
+        Hybrid,     // Coarse sleep, then spin for the last fraction of a millisecond
+        VSync       // Let SwapBuffers block on vertical blank; only measure
+    };
+
+    // Pacing error = actual frame period - target period
+    struct FramePacingStats {
+        uint64_t Frames = 0;
+        uint64_t LateFrames = 0;        // Frames more than LateThreshold over the target
+        double MeanErrorMs = 0.0;
+        double StdDevErrorMs = 0.0;
+        double MaxErrorMs = 0.0;        // Worst overshoot
+        double MinErrorMs = 0.0;        // Worst undershoot (negative = early)
+        double SpinMarginMs = 0.0;      // Current sleep/spin switch-over point
+    };
+
+    class FramePacer {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        FramePacingMode m_Mode = FramePacingMode::Unlimited;
+        double m_TargetPeriod = 0.0;                // Seconds, 0 = no target
+        Clock::time_point m_Deadline;
+        Clock::time_point m_LastFrame;
+        bool m_Started = false;
+
+        // Estimated worst-case sleep overshoot; we stop sleeping this long before the deadline
+        double m_SpinMargin = 0.001;
+
+        // Running error statistics (Welford)
+        FramePacingStats m_Stats;
+        double m_ErrorMean = 0.0;
+        double m_ErrorM2 = 0.0;
+
+    public:
+        static constexpr double LateThreshold = 0.0005;    // Seconds
+
+        // fps <= 0 removes the target
+        void SetTargetFPS(double fps);
+        double GetTargetFPS() const { return m_TargetPeriod > 0.0 ? 1.0 / m_TargetPeriod : 0.0; }
+
+        void SetMode(FramePacingMode mode);
+        FramePacingMode GetMode() const { return m_Mode; }
+
+        // Call once per frame; in Hybrid mode blocks until the next frame deadline
+        void Wait();
+
+        const FramePacingStats& GetStats() const { return m_Stats; }
+        void ResetStats();
+
+    private:
+        void SleepUntil(Clock::time_point deadline);
+        void RecordFrame(Clock::time_point now);
+    };
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace BunnyGL {
+
+    constexpr uint64_t Hash64Seed = 14695981039346656037ull;
+
+    // FNV-1a, 64 bit. Pass the previous result as seed to hash data in parts.
+    // Not cryptographic; used for content keys and integrity checks.
+    inline uint64_t Hash64(std::string_view data, uint64_t seed = Hash64Seed) {
+        uint64_t hash = seed;
+        for (unsigned char c : data) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // Hash64 of a value's bytes
+    template<typename T>
+    inline uint64_t Hash64Of(const T& value, uint64_t seed = Hash64Seed) {
+        static_assert(std::is_trivially_copyable_v<T>, "Hash64Of hashes the object representation");
+        return Hash64(std::string_view(reinterpret_cast<const char*>(&value), sizeof(T)), seed);
+    }
+
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BunnyGL {
+
+    using JobFunction = std::function<void()>;
+
+    struct Job;
+
+    // Counts unfinished jobs. Every job started with a counter increments it and
+    // decrements it when done, so one counter can track a whole batch. It must
+    // outlive its jobs, i.e. stay alive until JobSystem::Wait() on it returns.
+    class JobCounter {
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Pending{0};
+        std::atomic<uint32_t> m_Completing{0};  // Finishing jobs still touching the counter
+        std::mutex m_Mutex;
+        std::vector<Job*> m_Continuations;      // Jobs waiting for m_Pending to reach 0
+
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const {
+            return m_Pending.load(std::memory_order_acquire) == 0 &&
+                   m_Completing.load(std::memory_order_acquire) == 0;
+        }
+    };
+
+    // Chase-Lev work-stealing deque. The owning worker pushes and pops at the
+    // bottom (LIFO, cache-warm); other threads steal from the top (FIFO).
+    class WorkStealingDeque {
+    private:
+        std::unique_ptr<std::atomic<Job*>[]> m_Buffer;
+        int64_t m_Mask;
+        alignas(64) std::atomic<int64_t> m_Top{0};
+        alignas(64) std::atomic<int64_t> m_Bottom{0};
+
+    public:
+        // Capacity is rounded up to a power of two
+        explicit WorkStealingDeque(size_t capacity);
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // Owner only. Push returns false when full.
+        bool Push(Job* job);
+        Job* Pop();
+
+        // Any thread
+        Job* Steal();
+    };
+
+    // Worker pool with one work-stealing deque per worker. The thread that creates
+    // the system (the main thread) counts as worker 0 and executes jobs while it
+    // waits; threads outside the pool submit through a shared queue.
+    class JobSystem {
+    private:
+        struct Worker {
+            WorkStealingDeque Queue;
+            std::thread Thread;
+
+            Worker() : Queue(4096) {}
+        };
+
+        std::vector<std::unique_ptr<Worker>> m_Workers;     // [0] = creating thread
+        std::mutex m_SharedMutex;
+        std::deque<Job*> m_SharedQueue;                     // Submissions from non-worker threads
+
+        std::atomic<uint32_t> m_Queued{0};                  // Jobs sitting in any queue
+        std::atomic<uint32_t> m_Sleeping{0};
+        std::atomic<bool> m_Stopping{false};
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCV;
+
+    public:
+        // workerThreads = 0: one per hardware thread, minus the creating thread
+        explicit JobSystem(uint32_t workerThreads = 0);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // Queues a job. counter (optional) is incremented now and decremented when
+        // the job has run. The job does not start before dependency (optional) is done.
+        void Run(JobFunction function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+        // Blocks until counter is done, running other jobs in the meantime
+        void Wait(JobCounter& counter);
+
+        // Calls function(i) for i in [0, count), batchSize indices per job, and
+        // returns when all have run. The calling thread takes part.
+        template<typename F>
+        void ParallelFor(uint32_t count, uint32_t batchSize, const F& function) {
+            if (count == 0) {
+                return;
+            }
+            batchSize = std::max(batchSize, 1u);
+            if (count <= batchSize) {
+                for (uint32_t i = 0; i < count; ++i) function(i);
+                return;
+            }
+
+            JobCounter counter;
+            for (uint32_t begin = 0; begin < count; begin += batchSize) {
+                uint32_t end = std::min(begin + batchSize, count);
+                Run([&function, begin, end]() {
+                    for (uint32_t i = begin; i < end; ++i) function(i);
+                }, &counter);
+            }
+            Wait(counter);
+        }
+
+        // Worker threads plus the creating thread
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+        // Index of the calling thread in this pool ([0, GetThreadCount())), or -1
+        // for threads outside it. Handy for per-thread scratch buffers.
+        int GetThreadIndex() const;
+
+    private:
+        void Schedule(Job* job);
+        Job* FindJob(int threadIndex);
+        void Execute(Job* job);
+        void WorkerLoop(uint32_t index);
+    };
+
+}
@@ -1,9 +1,25 @@
 #pragma once
-#include <iostream>
-#include <string>
+#include <BunnyGL/Core/LogRecord.hpp>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+// Compile-time minimum severity. Statements below it compile to nothing,
+// arguments included. Override with -DBG_LOG_MIN_LEVEL=BG_LOG_LEVEL_<LEVEL>.
+#define BG_LOG_LEVEL_TRACE  0
+#define BG_LOG_LEVEL_DEBUG  1
+#define BG_LOG_LEVEL_INFO   2
+#define BG_LOG_LEVEL_WARN   3
+#define BG_LOG_LEVEL_ERROR  4
+
+#ifndef BG_LOG_MIN_LEVEL
+    #ifdef NDEBUG
+        #define BG_LOG_MIN_LEVEL BG_LOG_LEVEL_INFO
+    #else
+        #define BG_LOG_MIN_LEVEL BG_LOG_LEVEL_DEBUG
+    #endif
+#endif
 
 namespace BunnyGL {
 
@@ -21,91 +37,171 @@ namespace BunnyGL {
         static const std::string BOLD = "\033[1m";
     }
 
+    // Backend settings. Rings are per thread, so RingCapacity applies to
+    // threads that log for the first time after Configure().
+    struct LogConfig {
+        size_t RingCapacity = 1024;                             // Records per thread (256 bytes each)
+        LogOverflowPolicy Overflow = LogOverflowPolicy::Drop;
+        bool Console = true;                                    // Colored stdout/stderr output
+        std::string FilePath;                                   // Plain-text log file, empty = none
+        std::string BinaryFilePath;                             // Memory-mapped binary log, empty = none
+        size_t BinaryFileCapacity = 16 * 1024 * 1024;           // Initial mapping size, grows by doubling
+    };
+
+    // Callers only encode their arguments into a per-thread lock-free ring;
+    // timestamps, colors and console/file output are handled by a background thread.
     class Log {
     private:
-        static std::string getCurrentTime() {
-            auto now = std::chrono::system_clock::now();
-            auto time = std::chrono::system_clock::to_time_t(now);
-            std::stringstream ss;
-            ss << std::put_time(std::localtime(&time), "%H:%M:%S");
-            return ss.str();
-        }
-
-        static std::string getSourceFile(const std::string& filepath) {
-            // Extract just the filename from full path
-            size_t lastSlash = filepath.find_last_of("/\\");
-            if (lastSlash != std::string::npos) {
-                return filepath.substr(lastSlash + 1);
-            }
-            return filepath;
-        }
+        // Runtime minimum level per category, Trace by default (the compile-time level still applies)
+        static inline std::atomic<uint8_t> s_CategoryLevels[static_cast<size_t>(LogCategory::Count)] = {};
 
     public:
         // Info - Green
         template<typename... Args>
-        static void Info(const std::string& file, Args... args) {
-            std::cout << Colors::GREEN << "[" << getCurrentTime() << "]"
-                      << "[INFO]"
-                      << "[" << getSourceFile(file) << "] ";
-            printArgs(args...);
-            std::cout << Colors::RESET << std::endl;
+        static void Info(const char* file, Args&&... args) {
+            Write(LogLevel::Info, LogCategory::General, file, 0, std::forward<Args>(args)...);
         }
 
         // Warn - Yellow
         template<typename... Args>
-        static void Warn(const std::string& file, Args... args) {
-            std::cout << Colors::YELLOW << "[" << getCurrentTime() << "]"
-                      << "[WARN]"
-                      << "[" << getSourceFile(file) << "] ";
-            printArgs(args...);
-            std::cout << Colors::RESET << std::endl;
+        static void Warn(const char* file, Args&&... args) {
+            Write(LogLevel::Warn, LogCategory::General, file, 0, std::forward<Args>(args)...);
         }
 
         // Error - Red
         template<typename... Args>
-        static void Error(const std::string& file, Args... args) {
-            std::cerr << Colors::RED << "[" << getCurrentTime() << "]"
-                      << "[ERROR]"
-                      << "[" << getSourceFile(file) << "] ";
-            printArgs(args...);
-            std::cerr << Colors::RESET << std::endl;
+        static void Error(const char* file, Args&&... args) {
+            Write(LogLevel::Error, LogCategory::General, file, 0, std::forward<Args>(args)...);
         }
 
-        // Fatal - Red Bold (stops program)
+        // Fatal - Red Bold (flushes the backend, then stops program)
         template<typename... Args>
-        [[noreturn]] static void Fatal(const std::string& file, Args... args) {
-            std::cerr << Colors::BOLD << Colors::RED << "[" << getCurrentTime() << "]"
-                      << "[FATAL]"
-                      << "[" << getSourceFile(file) << "] ";
-            printArgs(args...);
-            std::cerr << Colors::RESET << std::endl;
+        [[noreturn]] static void Fatal(const char* file, Args&&... args) {
+            Write(LogLevel::Fatal, LogCategory::General, file, 0, std::forward<Args>(args)...);
+            Flush();
             std::exit(EXIT_FAILURE);
         }
 
         // Raw logging without formatting (for custom messages)
         template<typename... Args>
-        static void Raw(Args... args) {
-            printArgs(args...);
-            std::cout << std::endl;
+        static void Raw(Args&&... args) {
+            Write(LogLevel::Raw, LogCategory::General, "", 0, std::forward<Args>(args)...);
         }
 
-    private:
-        // Base case for recursive template
-        static void printArgs() {}
-
-        // Recursive variadic template to print all arguments
-        template<typename T, typename... Args>
-        static void printArgs(T first, Args... rest) {
-            std::cout << first;
-            printArgs(rest...);
+        // Used by the BG_* macros after filtering; file must be a string literal
+        template<typename... Args>
+        static void Write(LogLevel level, LogCategory category, const char* file, uint32_t line, Args&&... args) {
+            if (!IsEnabled(category, level)) {
+                return;
+            }
+
+            LogRecord* record = AcquireRecord();
+            if (!record) {
+                return; // Ring full and policy is Drop
+            }
+
+            record->Timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            record->File = file;
+            record->Line = line;
+            record->Level = level;
+            record->Category = category;
+
+            LogArgEncoder encoder(record->Payload, LogRecord::PayloadCapacity);
+            (encoder.Encode(std::forward<Args>(args)), ...);
+            record->PayloadSize = static_cast<uint16_t>(encoder.GetSize());
+            record->Truncated = encoder.IsTruncated();
+
+            CommitRecord();
+        }
+
+        // Runtime per-category filtering (Fatal and Raw are never filtered)
+        static void SetLevel(LogCategory category, LogLevel level) {
+            s_CategoryLevels[static_cast<size_t>(category)].store(static_cast<uint8_t>(level), std::memory_order_relaxed);
         }
+
+        static void SetLevel(LogLevel level) {
+            for (auto& categoryLevel : s_CategoryLevels) {
+                categoryLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+            }
+        }
+
+        static bool IsEnabled(LogCategory category, LogLevel level) {
+            return level >= LogLevel::Fatal ||
+                   static_cast<uint8_t>(level) >= s_CategoryLevels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+        }
+
+        // Filename part of a path, usable on __FILE__ at compile time
+        static constexpr const char* StripPath(const char* path) {
+            const char* name = path;
+            for (const char* p = path; *p; ++p) {
+                if (*p == '/' || *p == '\\') name = p + 1;
+            }
+            return name;
+        }
+
+        // Backend control
+        static void Configure(const LogConfig& config);
+        static void Flush();                    // Blocks until everything logged so far is written
+        static uint64_t GetDroppedCount();
+
+    private:
+        // Slot in the calling thread's ring (implemented in Log.cpp)
+        static LogRecord* AcquireRecord();
+        static void CommitRecord();
     };
 
 } // namespace BunnyGL
 
-// Convenience macros (these automatically add __FILE__)
-#define BG_INFO(...)    BunnyGL::Log::Info(__FILE__, __VA_ARGS__)
-#define BG_WARN(...)    BunnyGL::Log::Warn(__FILE__, __VA_ARGS__)
-#define BG_ERROR(...)   BunnyGL::Log::Error(__FILE__, __VA_ARGS__)
-#define BG_FATAL(...)   BunnyGL::Log::Fatal(__FILE__, __VA_ARGS__)
-#define BG_RAW(...)     BunnyGL::Log::Raw(__VA_ARGS__)
\ No newline at end of file
+// Convenience macros. The runtime check runs before any argument is evaluated,
+// and the file name is stripped at compile time.
+#define BG_LOG_STATEMENT(level, category, ...) \
+    do { \
+        if (BunnyGL::Log::IsEnabled(category, level)) { \
+            constexpr const char* bgLogFile_ = BunnyGL::Log::StripPath(__FILE__); \
+            BunnyGL::Log::Write(level, category, bgLogFile_, __LINE__, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define BG_LOG_DISABLED(...) do {} while (0)
+
+// Generic form with an explicit category, e.g. BG_LOG(Debug, Renderer, "...")
+#define BG_LOG(level, category, ...) \
+    do { \
+        if constexpr (static_cast<int>(BunnyGL::LogLevel::level) >= BG_LOG_MIN_LEVEL) { \
+            BG_LOG_STATEMENT(BunnyGL::LogLevel::level, BunnyGL::LogCategory::category, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#if BG_LOG_MIN_LEVEL <= BG_LOG_LEVEL_TRACE
+    #define BG_TRACE(...)   BG_LOG_STATEMENT(BunnyGL::LogLevel::Trace, BunnyGL::LogCategory::General, __VA_ARGS__)
+#else
+    #define BG_TRACE(...)   BG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if BG_LOG_MIN_LEVEL <= BG_LOG_LEVEL_DEBUG
+    #define BG_DEBUG(...)   BG_LOG_STATEMENT(BunnyGL::LogLevel::Debug, BunnyGL::LogCategory::General, __VA_ARGS__)
+#else
+    #define BG_DEBUG(...)   BG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if BG_LOG_MIN_LEVEL <= BG_LOG_LEVEL_INFO
+    #define BG_INFO(...)    BG_LOG_STATEMENT(BunnyGL::LogLevel::Info, BunnyGL::LogCategory::General, __VA_ARGS__)
+#else
+    #define BG_INFO(...)    BG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if BG_LOG_MIN_LEVEL <= BG_LOG_LEVEL_WARN
+    #define BG_WARN(...)    BG_LOG_STATEMENT(BunnyGL::LogLevel::Warn, BunnyGL::LogCategory::General, __VA_ARGS__)
+#else
+    #define BG_WARN(...)    BG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if BG_LOG_MIN_LEVEL <= BG_LOG_LEVEL_ERROR
+    #define BG_ERROR(...)   BG_LOG_STATEMENT(BunnyGL::LogLevel::Error, BunnyGL::LogCategory::General, __VA_ARGS__)
+#else
+    #define BG_ERROR(...)   BG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#define BG_FATAL(...)   BunnyGL::Log::Fatal(BunnyGL::Log::StripPath(__FILE__), __VA_ARGS__)
+#define BG_RAW(...)     BunnyGL::Log::Raw(__VA_ARGS__)
@@ -0,0 +1,99 @@
+#pragma once
+#include <BunnyGL/Core/LogRecord.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace BunnyGL {
+
+    // On-disk layout of binary logs (*.bglog), read back by bunnygl-logdecode.
+    //
+    //   FileHeader, then a stream of chunks, each starting with a ChunkType byte:
+    //     Site    : uint32 id, uint32 line, uint8 level, uint8 category, uint16 length, file name,
+    //               uint8 literal count, then per literal: uint16 length, text
+    //     Event   : uint32 site id, int64 timestamp, uint8 truncated, uint16 size, encoded args
+    //     Dropped : uint64 count
+    //   A zero byte (ChunkType::End) or the end of the file terminates the stream.
+    //
+    // A site is a unique (file, line, level, category) logging statement. It is
+    // written once, together with the const char array (literal) arguments of
+    // its first event, and events only reference it by id. In event payloads an
+    // argument matching one of those texts is a one-byte index into the site's
+    // table (LogArgType::SiteLiteral), so the static text of a statement is not
+    // repeated; everything else stays in its raw encoded form, and text the
+    // site doesn't know is written as a plain string.
+    namespace LogBinaryFormat {
+        static constexpr char Magic[8] = { 'B', 'G', 'L', 'O', 'G', 0, 0, 0 };
+        static constexpr uint32_t Version = 2;
+        static constexpr size_t MaxSiteLiterals = 255;
+
+        enum class ChunkType : uint8_t {
+            End = 0,
+            Site = 1,
+            Event = 2,
+            Dropped = 3
+        };
+
+        struct FileHeader {
+            char Magic[8];
+            uint32_t Version;
+            uint32_t Reserved;
+        };
+    }
+
+    // Appends records to a memory-mapped binary log. Used by the logging
+    // backend thread only, so it does no locking of its own.
+    class LogBinarySink {
+    private:
+        struct SiteKey {
+            const char* File;
+            uint32_t Line;
+            uint8_t Level;
+            uint8_t Category;
+
+            bool operator==(const SiteKey& other) const {
+                return File == other.File && Line == other.Line && Level == other.Level && Category == other.Category;
+            }
+        };
+
+        struct SiteKeyHash {
+            size_t operator()(const SiteKey& key) const {
+                size_t hash = std::hash<const void*>()(key.File);
+                hash ^= (static_cast<size_t>(key.Line) << 16) ^ (static_cast<size_t>(key.Level) << 8) ^ key.Category;
+                return hash;
+            }
+        };
+
+        struct Site {
+            uint32_t Id;
+            std::vector<std::string> Literals;      // Index = LogArgType::SiteLiteral value
+        };
+
+        int m_FileDescriptor = -1;
+        uint8_t* m_Mapping = nullptr;
+        size_t m_Capacity = 0;
+        size_t m_Size = 0;
+        std::unordered_map<SiteKey, Site, SiteKeyHash> m_Sites;
+
+    public:
+        LogBinarySink() = default;
+        ~LogBinarySink();
+
+        LogBinarySink(const LogBinarySink&) = delete;
+        LogBinarySink& operator=(const LogBinarySink&) = delete;
+
+        bool Open(const std::string& filepath, size_t initialCapacity);
+        void Close();
+        bool IsOpen() const { return m_Mapping != nullptr; }
+
+        void Append(const LogRecord& record);
+        void AppendDropped(uint64_t count);
+
+    private:
+        uint8_t* Reserve(size_t bytes);
+        bool Remap(size_t capacity);
+        const Site& GetSite(const LogRecord& record);
+    };
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <BunnyGL/Core/LogRecord.hpp>
+#include <ostream>
+#include <sstream>
+
+namespace BunnyGL {
+
+    // Turns log records into the "[HH:MM:SS][LEVEL][file] message" text format.
+    // Shared by the logging backend and the bunnygl-logdecode tool; not thread-safe.
+    class LogFormatter {
+    private:
+        std::ostringstream m_Message;
+        int64_t m_CachedSecond = -1;
+        char m_CachedTime[16] = {};
+
+    public:
+        // Either stream may be null; colored gets ANSI colors, plain does not
+        void Write(const LogRecord& record, std::ostream* colored, std::ostream* plain);
+        // Same, with the arguments taken from payload instead of record.Payload
+        // (which is capped at LogRecord::PayloadCapacity)
+        void Write(const LogRecord& record, const uint8_t* payload, size_t payloadSize,
+                   std::ostream* colored, std::ostream* plain);
+
+    private:
+        const char* FormatTime(int64_t timestampNs);
+    };
+
+}
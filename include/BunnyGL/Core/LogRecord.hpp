@@ -0,0 +1,259 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace BunnyGL {
+
+    enum class LogLevel : uint8_t {
+        Trace,
+        Debug,
+        Info,
+        Warn,
+        Error,
+        Fatal,
+        Raw
+    };
+
+    // Runtime filtering groups, each with its own minimum level
+    enum class LogCategory : uint8_t {
+        General,
+        Core,
+        Renderer,
+        Resources,
+        Scene,
+        Count
+    };
+
+    // What the backend does when a thread's ring buffer is full
+    enum class LogOverflowPolicy : uint8_t {
+        Drop,   // Discard the message and count it
+        Block   // Wait for the backend thread to make room
+    };
+
+    // Compact, fixed-size log record. The caller only stores raw argument
+    // bytes; formatting happens later on the backend thread.
+    struct LogRecord {
+        static constexpr size_t Size = 256;
+        static constexpr size_t HeaderSize = 32;
+        static constexpr size_t PayloadCapacity = Size - HeaderSize;
+
+        int64_t Timestamp;      // system_clock, nanoseconds since epoch
+        const char* File;       // Always a string literal (__FILE__)
+        uint32_t Line;          // 0 when not logged through a macro
+        LogLevel Level;
+        LogCategory Category;
+        bool Truncated;
+        uint16_t PayloadSize;
+        uint8_t Payload[PayloadCapacity];
+    };
+    static_assert(sizeof(LogRecord) == LogRecord::Size, "LogRecord must stay one ring slot");
+
+    // Type tags used in the encoded argument stream
+    enum class LogArgType : uint8_t {
+        Bool,
+        Char,
+        Int,
+        UInt,
+        Float,
+        String,
+        Pointer,
+        ConstString,    // Like String; from a const char array, usually a literal
+        SiteLiteral     // Binary logs only: uint8 index into the site's literal table
+    };
+
+    // Writes log arguments as (tag, raw bytes) pairs into a record payload
+    class LogArgEncoder {
+    private:
+        uint8_t* m_Data;
+        size_t m_Capacity;
+        size_t m_Size = 0;
+        bool m_Truncated = false;
+
+    public:
+        LogArgEncoder(uint8_t* data, size_t capacity) : m_Data(data), m_Capacity(capacity) {}
+
+        size_t GetSize() const { return m_Size; }
+        bool IsTruncated() const { return m_Truncated; }
+
+        // const char arrays (string literals, mostly) are tagged ConstString so
+        // the binary sink can intern their text; like every string they are copied
+        template<typename T>
+        void Encode(T&& value) {
+            using U = std::decay_t<T>;
+            using A = std::remove_reference_t<T>;
+            if constexpr (std::is_same_v<U, bool>) {
+                WriteScalar(LogArgType::Bool, static_cast<uint8_t>(value));
+            } else if constexpr (std::is_same_v<U, char> || std::is_same_v<U, signed char> || std::is_same_v<U, unsigned char>) {
+                WriteScalar(LogArgType::Char, static_cast<char>(value));
+            } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+                WriteScalar(LogArgType::Int, static_cast<int64_t>(value));
+            } else if constexpr (std::is_integral_v<U>) {
+                WriteScalar(LogArgType::UInt, static_cast<uint64_t>(value));
+            } else if constexpr (std::is_floating_point_v<U>) {
+                WriteScalar(LogArgType::Float, static_cast<double>(value));
+            } else if constexpr (std::is_array_v<A> && std::is_same_v<std::remove_extent_t<A>, const char>) {
+                WriteString(std::string_view(value), LogArgType::ConstString);
+            } else if constexpr (std::is_array_v<A> && std::is_same_v<std::remove_extent_t<A>, char>) {
+                WriteString(std::string_view(value));
+            } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+                WriteString(value ? std::string_view(value) : std::string_view("(null)"));
+            } else if constexpr (std::is_convertible_v<const A&, std::string_view>) {
+                WriteString(std::string_view(value));
+            } else if constexpr (std::is_same_v<U, const unsigned char*> || std::is_same_v<U, unsigned char*>) {
+                // glGetString() and friends return GLubyte strings
+                WriteString(value ? std::string_view(reinterpret_cast<const char*>(value)) : std::string_view("(null)"));
+            } else if constexpr (std::is_pointer_v<U>) {
+                WriteScalar(LogArgType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+            } else {
+                // Anything else falls back to its stream operator on the calling thread
+                std::ostringstream ss;
+                ss << value;
+                WriteString(ss.str());
+            }
+        }
+
+    private:
+        template<typename T>
+        void WriteScalar(LogArgType type, T value) {
+            if (m_Size + 1 + sizeof(T) > m_Capacity) {
+                m_Truncated = true;
+                return;
+            }
+            m_Data[m_Size++] = static_cast<uint8_t>(type);
+            std::memcpy(m_Data + m_Size, &value, sizeof(T));
+            m_Size += sizeof(T);
+        }
+
+        void WriteString(std::string_view str, LogArgType type = LogArgType::String) {
+            if (m_Size + 1 + sizeof(uint16_t) > m_Capacity) {
+                m_Truncated = true;
+                return;
+            }
+            size_t available = m_Capacity - m_Size - 1 - sizeof(uint16_t);
+            uint16_t length = static_cast<uint16_t>(str.size() < available ? str.size() : available);
+            if (length < str.size()) {
+                m_Truncated = true;
+            }
+            m_Data[m_Size++] = static_cast<uint8_t>(type);
+            std::memcpy(m_Data + m_Size, &length, sizeof(length));
+            m_Size += sizeof(length);
+            std::memcpy(m_Data + m_Size, str.data(), length);
+            m_Size += length;
+        }
+    };
+
+    // Bytes following the tag of an argument of this type (string: also its
+    // text, whose length starts at value); 0 for an unknown type
+    inline size_t GetLogArgSize(LogArgType type, const uint8_t* value) {
+        switch (type) {
+            case LogArgType::Bool:
+            case LogArgType::Char:        return 1;
+            case LogArgType::Int:
+            case LogArgType::UInt:
+            case LogArgType::Float:
+            case LogArgType::Pointer:     return 8;
+            case LogArgType::SiteLiteral: return 1;
+            case LogArgType::String:
+            case LogArgType::ConstString: {
+                uint16_t length;
+                std::memcpy(&length, value, sizeof(length));
+                return sizeof(length) + length;
+            }
+            default:                      return 0;
+        }
+    }
+
+    // Turns an encoded argument stream back into text
+    inline void DecodeLogArgs(std::ostream& os, const uint8_t* data, size_t size) {
+        size_t pos = 0;
+        auto read = [&](auto& out) {
+            std::memcpy(&out, data + pos, sizeof(out));
+            pos += sizeof(out);
+        };
+
+        while (pos < size) {
+            LogArgType type = static_cast<LogArgType>(data[pos++]);
+            switch (type) {
+                case LogArgType::Bool:    { uint8_t v; read(v); os << static_cast<bool>(v); break; }
+                case LogArgType::Char:    { char v; read(v); os << v; break; }
+                case LogArgType::Int:     { int64_t v; read(v); os << v; break; }
+                case LogArgType::UInt:    { uint64_t v; read(v); os << v; break; }
+                case LogArgType::Float:   { double v; read(v); os << v; break; }
+                case LogArgType::Pointer: { uint64_t v; read(v); os << reinterpret_cast<const void*>(static_cast<uintptr_t>(v)); break; }
+                case LogArgType::String:
+                case LogArgType::ConstString: {
+                    uint16_t length;
+                    read(length);
+                    os.write(reinterpret_cast<const char*>(data + pos), length);
+                    pos += length;
+                    break;
+                }
+                default:
+                    return; // Corrupt stream, stop here
+            }
+        }
+    }
+
+    // Single-producer / single-consumer ring of log records.
+    // The owning thread writes, the backend thread reads; no locks on either side.
+    class LogRingBuffer {
+    private:
+        std::unique_ptr<LogRecord[]> m_Slots;
+        size_t m_Mask;
+        alignas(64) std::atomic<size_t> m_Head{0};   // Next slot to read (consumer)
+        alignas(64) std::atomic<size_t> m_Tail{0};   // Next slot to write (producer)
+
+    public:
+        // Capacity is rounded up to a power of two
+        explicit LogRingBuffer(size_t capacity) {
+            size_t size = 1;
+            while (size < capacity) size <<= 1;
+            m_Slots = std::make_unique<LogRecord[]>(size);
+            m_Mask = size - 1;
+        }
+
+        LogRingBuffer(const LogRingBuffer&) = delete;
+        LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+        // Producer: returns the slot to fill, or nullptr if the ring is full
+        LogRecord* BeginWrite() {
+            size_t tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail - m_Head.load(std::memory_order_acquire) > m_Mask) {
+                return nullptr;
+            }
+            return &m_Slots[tail & m_Mask];
+        }
+
+        // Producer: publishes the slot returned by BeginWrite()
+        void EndWrite() {
+            m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // Consumer: oldest unread record, or nullptr if empty
+        const LogRecord* Peek() const {
+            size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head == m_Tail.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            return &m_Slots[head & m_Mask];
+        }
+
+        // Consumer: releases the record returned by Peek()
+        void Pop() {
+            m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool IsEmpty() const {
+            return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+        }
+    };
+
+} // namespace BunnyGL
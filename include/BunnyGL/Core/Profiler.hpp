@@ -0,0 +1,131 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Set to 0 to compile every BG_PROFILE_* macro out
+#ifndef BG_ENABLE_PROFILING
+    #define BG_ENABLE_PROFILING 1
+#endif
+
+namespace BunnyGL {
+
+    // One finished zone. Name must outlive the profiler (string literal / __func__).
+    struct ProfileEvent {
+        const char* Name;
+        int64_t Start;          // Nanoseconds since Profiler::Now() epoch
+        int64_t End;
+        uint32_t Depth;         // Nesting level within the thread
+        uint32_t Frame;
+    };
+
+    // CPU profiler. Zones are written by their own thread into a private
+    // chunked buffer (no locks, no sharing); export walks those buffers afterwards.
+    // Recording is only active inside the capture frame range.
+    class Profiler {
+    private:
+        static inline std::atomic<bool> s_Recording{false};
+        static inline std::atomic<uint32_t> s_Frame{0};
+        static inline std::atomic<uint32_t> s_CaptureFirst{1};
+        static inline std::atomic<uint32_t> s_CaptureLast{0};
+        static inline thread_local uint32_t s_ThreadFrame = UINT32_MAX;
+
+    public:
+        static constexpr uint32_t CurrentFrame = UINT32_MAX;
+
+        // Called by Application at the start of every frame
+        static void BeginFrame();
+        static uint32_t GetFrame() { return s_Frame.load(std::memory_order_relaxed); }
+
+        // Frame the calling thread's zones belong to: the render thread replays
+        // frame N while the main thread already records N + 1. CurrentFrame
+        // makes the thread follow GetFrame() again.
+        static void SetThreadFrame(uint32_t frame) { s_ThreadFrame = frame; }
+        static uint32_t GetThreadFrame() { return s_ThreadFrame == CurrentFrame ? GetFrame() : s_ThreadFrame; }
+
+        // A frame still being worked on by another thread; the automatic
+        // capture export waits until every retained frame is released
+        static void RetainFrame(uint32_t frame);
+        static void ReleaseFrame(uint32_t frame);
+
+        // Record frames [firstFrame, lastFrame]; if outputPath is set, the trace
+        // is written there automatically once lastFrame has finished
+        static void SetCapture(uint32_t firstFrame, uint32_t lastFrame, const std::string& outputPath = "");
+        static bool IsRecording() {
+            if (s_ThreadFrame == CurrentFrame) {
+                return s_Recording.load(std::memory_order_relaxed);
+            }
+            return s_ThreadFrame >= s_CaptureFirst.load(std::memory_order_relaxed) &&
+                   s_ThreadFrame <= s_CaptureLast.load(std::memory_order_relaxed);
+        }
+
+        // Chrome trace-event JSON (chrome://tracing, Perfetto) for a frame range
+        static bool ExportChromeTrace(const std::string& path, uint32_t firstFrame, uint32_t lastFrame);
+
+        // Name shown for the calling thread in exported traces
+        static void SetThreadName(const std::string& name);
+
+        static int64_t Now();
+        static void RecordZone(const char* name, int64_t start, int64_t end, uint32_t depth);
+
+        // Extra timelines that are not CPU threads (e.g. GPU queues). A track
+        // must only be written from one thread at a time, like a thread buffer.
+        static uint32_t CreateTrack(const std::string& name);
+        static void RecordTrackZone(uint32_t track, const char* name, int64_t start, int64_t end, uint32_t depth, uint32_t frame);
+
+        // Per-thread nesting depth, maintained by ProfileScope
+        static uint32_t& ThreadDepth();
+
+    private:
+        static void TryExportCapture();
+    };
+
+    // Sets the calling thread's frame for the lifetime of the scope
+    class ProfileFrameScope {
+    public:
+        explicit ProfileFrameScope(uint32_t frame) { Profiler::SetThreadFrame(frame); }
+        ~ProfileFrameScope() { Profiler::SetThreadFrame(Profiler::CurrentFrame); }
+
+        ProfileFrameScope(const ProfileFrameScope&) = delete;
+        ProfileFrameScope& operator=(const ProfileFrameScope&) = delete;
+    };
+
+    // RAII zone; use through BG_PROFILE_SCOPE / BG_PROFILE_FUNCTION
+    class ProfileScope {
+    private:
+        const char* m_Name;
+        int64_t m_Start = 0;
+        bool m_Active;
+
+    public:
+        explicit ProfileScope(const char* name) : m_Name(name), m_Active(Profiler::IsRecording()) {
+            if (m_Active) {
+                Profiler::ThreadDepth()++;
+                m_Start = Profiler::Now();
+            }
+        }
+
+        ~ProfileScope() {
+            if (m_Active) {
+                int64_t end = Profiler::Now();
+                uint32_t depth = --Profiler::ThreadDepth();
+                Profiler::RecordZone(m_Name, m_Start, end, depth);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+
+}
+
+#define BG_PROFILE_CONCAT_IMPL(a, b) a##b
+#define BG_PROFILE_CONCAT(a, b) BG_PROFILE_CONCAT_IMPL(a, b)
+
+#if BG_ENABLE_PROFILING
+    #define BG_PROFILE_SCOPE(name)  BunnyGL::ProfileScope BG_PROFILE_CONCAT(bgProfileScope_, __LINE__)(name)
+    #define BG_PROFILE_FUNCTION()   BG_PROFILE_SCOPE(__func__)
+#else
+    #define BG_PROFILE_SCOPE(name)  do {} while (0)
+    #define BG_PROFILE_FUNCTION()   do {} while (0)
+#endif
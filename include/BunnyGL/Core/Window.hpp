@@ -1,28 +1,73 @@
 #pragma once
 #include <string>
+#include <vector>
 
 struct GLFWwindow;
 
 namespace BunnyGL {
 
+    struct WindowSpecification {
+        int Width = 1280;
+        int Height = 720;
+        std::string Title = "BunnyGL";
+        // No display needed: an EGL surfaceless context (e.g. Mesa llvmpipe)
+        // rendering into an offscreen framebuffer of Width x Height
+        bool Headless = false;
+    };
+
     class Window {
 
     private:
-        GLFWwindow* m_Window;
+        GLFWwindow* m_Window = nullptr;
         int m_Width;
         int m_Height;
+        int m_SwapInterval = 0;
+        bool m_Headless = false;
+        bool m_CloseRequested = false;
+        // Headless backend (EGL types kept out of the header)
+        void* m_EGLDisplay = nullptr;
+        void* m_EGLContext = nullptr;
+        void* (*m_ProcLoader)(const char*) = nullptr;
+        unsigned int m_Framebuffer = 0;
+        unsigned int m_ColorBuffer = 0;
+        unsigned int m_DepthBuffer = 0;
 
     public:
-        Window(int width = 1280, int height = 720, const std::string& title = "BunnyGL");
+        Window(const WindowSpecification& spec = WindowSpecification());
         ~Window();
 
+        Window(const Window&) = delete;
+        Window& operator=(const Window&) = delete;
+
         void SwapBuffers();
         void PollEvents();
         bool ShouldClose() const;
+        void Close();
+
+        // 0 = no VSync, 1 = every vertical blank, 2 = every other one, ...
+        void SetSwapInterval(int interval);
+        int GetSwapInterval() const { return m_SwapInterval; }
+        int GetRefreshRate() const;     // Primary monitor, 0 if unknown
+
+        // RGBA8 copy of the current frame, bottom row first (context thread only)
+        void ReadPixels(std::vector<unsigned char>& pixels) const;
+
+        // Moves the GL context between threads (see RenderThread)
+        void MakeContextCurrent();
+        void ReleaseContext();
+
+        // GL entry points outside the loader's core set (extensions)
+        void* GetProcAddress(const char* name) const;
 
         int GetWidth() const { return m_Width; }
         int GetHeight() const { return m_Height; }
+        bool IsHeadless() const { return m_Headless; }
         GLFWwindow* GetNativeWindow() const { return m_Window; }
+
+    private:
+        void CreateWindowed(const WindowSpecification& spec);
+        void CreateHeadless(const WindowSpecification& spec);
+        void LoadGL(void* (*loader)(const char*));
     };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace BunnyGL {
+
+    enum class BufferType : uint8_t {
+        Vertex,     // GL_ARRAY_BUFFER
+        Index,      // GL_ELEMENT_ARRAY_BUFFER
+        Uniform     // GL_UNIFORM_BUFFER
+    };
+
+    enum class IndexFormat : uint8_t {
+        UInt16,
+        UInt32
+    };
+
+    enum class BufferUsage : uint8_t {
+        Static,     // Written once
+        Dynamic     // Rewritten with SetData
+    };
+
+    // GL buffer object. Create, update and destroy on the GL thread.
+    class Buffer {
+    private:
+        unsigned int m_RendererID = 0;
+        BufferType m_Type;
+        BufferUsage m_Usage;
+        size_t m_Size = 0;
+
+    public:
+        // data may be null to allocate uninitialized storage
+        Buffer(BufferType type, const void* data, size_t size, BufferUsage usage = BufferUsage::Static);
+        ~Buffer();
+
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        // Overwrites [offset, offset + size); grows the buffer (dropping its contents) if needed
+        void SetData(const void* data, size_t size, size_t offset = 0);
+
+        // Binds to the type's target. Index buffers attach to the bound vertex array.
+        void Bind() const;
+
+        unsigned int GetRendererID() const { return m_RendererID; }
+        BufferType GetType() const { return m_Type; }
+        size_t GetSize() const { return m_Size; }
+    };
+
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <BunnyGL/Renderer/Buffer.hpp>
+#include <BunnyGL/Renderer/Shader.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Renderer/UniformArena.hpp>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace BunnyGL {
+
+    enum class PrimitiveType : uint8_t {
+        Triangles,
+        TriangleStrip,
+        Lines,
+        Points
+    };
+
+    enum class RenderCommandType : uint8_t {
+        Clear,
+        SetViewport,
+        BindShader,
+        BindPipeline,
+        SetUniform,
+        BindUniformBlock,
+        BindVertexArray,
+        BindTexture,
+        DrawArrays,
+        DrawIndexed,
+        Callback
+    };
+
+    // One recorded command. Callbacks live in the list's callback table and
+    // are referenced by index.
+    struct RenderCommand {
+        RenderCommandType Type;
+        PrimitiveType Primitive;
+        UniformType ValueType;  // SetUniform
+        UniformHandle Uniform;
+        uint32_t Index;         // Callback index, first vertex, block binding, texture unit, index format, ...
+        uint32_t Count;
+        UniformAllocation Block;
+        union {
+            float Color[4];
+            int32_t Rect[4];
+            int32_t Int;
+            float Floats[16];   // float, vec2-4, mat3 (column-major), mat4
+            Shader* ShaderPtr;
+            const PipelineState* Pipeline;
+            uint32_t Handle;
+        };
+    };
+
+    // Backend-agnostic draw recording. Scenes fill one in OnRender; the
+    // renderer replays it later, possibly on the render thread, so recording
+    // never touches the graphics API. Objects referenced by the list (shaders,
+    // vertex arrays) must stay alive until the frame has been rendered.
+    // Replay goes through the RenderStateCache, so binding the same shader,
+    // pipeline or vertex array again costs nothing.
+    class CommandList {
+    private:
+        std::vector<RenderCommand> m_Commands;
+        std::vector<uint8_t> m_UniformData;     // Uploaded to the UniformArena in one go
+        std::vector<std::function<void()>> m_Callbacks;
+
+    public:
+        // Keeps the allocations for the next frame
+        void Reset();
+
+        void Clear(const glm::vec4& color);
+        void SetViewport(int x, int y, int width, int height);
+
+        // Uniforms apply to the most recently bound shader; handles come from
+        // that shader's GetUniformHandle()
+        void BindShader(Shader* shader);
+        // Shader plus blend/depth/cull state; only the differences are applied
+        void BindPipeline(const PipelineState* pipeline);
+        void SetUniform(UniformHandle uniform, int value);
+        void SetUniform(UniformHandle uniform, float value);
+        void SetUniform(UniformHandle uniform, const glm::vec2& value);
+        void SetUniform(UniformHandle uniform, const glm::vec3& value);
+        void SetUniform(UniformHandle uniform, const glm::vec4& value);
+        void SetUniform(UniformHandle uniform, const glm::mat3& value);
+        void SetUniform(UniformHandle uniform, const glm::mat4& value);
+
+        // Uniform block data (std140, see Std140.hpp) for this frame. All of a
+        // list's blocks reach the GPU in a single upload when it is executed.
+        template<typename T>
+        UniformAllocation AllocateUniforms(const T& data) {
+            static_assert(std::is_trivially_copyable_v<T>, "Uniform block data must be trivially copyable");
+            return AllocateUniforms(&data, sizeof(T));
+        }
+        UniformAllocation AllocateUniforms(const void* data, uint32_t size);
+
+        // glBindBufferRange of an allocation to a binding point (see UniformBinding)
+        void BindUniformBlock(uint32_t binding, UniformAllocation allocation);
+
+        void BindVertexArray(uint32_t vertexArray);
+        void BindTexture(uint32_t unit, uint32_t texture);     // GL_TEXTURE_2D
+        void DrawArrays(PrimitiveType primitive, uint32_t first, uint32_t count);
+        void DrawIndexed(PrimitiveType primitive, uint32_t indexCount,    // Indices from the bound VAO
+                         IndexFormat format = IndexFormat::UInt32);
+
+        // Escape hatch for anything without a command; runs on the thread
+        // that owns the graphics context
+        void Submit(std::function<void()> callback);
+
+        size_t GetCommandCount() const { return m_Commands.size(); }
+        size_t GetUniformDataSize() const { return m_UniformData.size(); }
+        bool IsEmpty() const { return m_Commands.empty(); }
+
+        // Replays the list through OpenGL. Must be called with the context current.
+        void Execute() const;
+
+    private:
+        RenderCommand& Push(RenderCommandType type);
+        void PushUniform(UniformHandle uniform, UniformType type, const float* values, size_t count);
+    };
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <BunnyGL/Core/Profiler.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace BunnyGL {
+
+    struct GpuFrameResult {
+        uint32_t Frame = 0;         // Profiler frame number
+        double TimeMs = 0.0;        // Sum of top-level zones
+    };
+
+    // GPU zone timing with GL_TIMESTAMP queries. Each frame writes into one slot
+    // of a small ring, and a slot is only read back when the frame comes around
+    // again (FramesInFlight - 1 frames later) and its results are available, so
+    // the CPU never waits on the GPU. Resolved zones go to the profiler's "GPU"
+    // track, aligned with the CPU zones.
+    //
+    // Software rasterizers (llvmpipe, softpipe, SwiftShader) have no meaningful
+    // GPU clock; there the zones are timed on the CPU instead.
+    // Must be used from the thread that owns the GL context, except for the
+    // result getters, which any thread may call.
+    class GpuProfiler {
+    public:
+        static constexpr uint32_t FramesInFlight = 4;
+        static constexpr uint32_t MaxZonesPerFrame = 64;
+        static constexpr uint32_t MaxQueuedResults = 256;
+
+        static void Init();
+        static void Shutdown();
+
+        // Resolves finished frames and starts recording a new one. frame is the
+        // profiler frame the commands were recorded in; with a render thread
+        // that is no longer the current one.
+        static void BeginFrame(uint32_t frame);
+
+        // Returns a zone index for EndZone, or -1 if the zone was not recorded
+        static int BeginZone(const char* name);
+        static void EndZone(int zone);
+
+        static bool IsHardwareTimed();
+
+        // Most recently resolved frame (a few frames behind the current one)
+        static GpuFrameResult GetLastResult();
+        // Appends every frame resolved since the last call, oldest first.
+        // Beyond MaxQueuedResults undrained results the oldest are discarded.
+        static void DrainResults(std::vector<GpuFrameResult>& results);
+        static uint64_t GetDroppedFrames();     // Slots reused before their results arrived
+    };
+
+    class GpuProfileScope {
+    private:
+        int m_Zone;
+
+    public:
+        explicit GpuProfileScope(const char* name) : m_Zone(GpuProfiler::BeginZone(name)) {}
+        ~GpuProfileScope() { GpuProfiler::EndZone(m_Zone); }
+
+        GpuProfileScope(const GpuProfileScope&) = delete;
+        GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+    };
+
+}
+
+#if BG_ENABLE_PROFILING
+    #define BG_GPU_PROFILE_SCOPE(name)  BunnyGL::GpuProfileScope BG_PROFILE_CONCAT(bgGpuProfileScope_, __LINE__)(name)
+#else
+    #define BG_GPU_PROFILE_SCOPE(name)  do {} while (0)
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#include <BunnyGL/Renderer/Buffer.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace BunnyGL {
+
+    // Float vertex attribute; its location is its index in the layout
+    struct VertexAttribute {
+        uint32_t Components;    // 1 to 4
+        uint32_t Offset;        // Bytes from the start of the vertex
+    };
+
+    struct VertexLayout {
+        std::vector<VertexAttribute> Attributes;
+        uint32_t Stride = 0;    // Bytes per vertex
+    };
+
+    // Vertex array with its vertex buffer and optional 16 or 32-bit index
+    // buffer. Create and destroy on the GL thread.
+    class Mesh {
+    private:
+        unsigned int m_VertexArray = 0;
+        std::unique_ptr<Buffer> m_VertexBuffer;
+        std::unique_ptr<Buffer> m_IndexBuffer;
+        VertexLayout m_Layout;
+        uint32_t m_VertexCount = 0;
+        uint32_t m_IndexCount = 0;
+        IndexFormat m_IndexFormat = IndexFormat::UInt32;
+
+    public:
+        Mesh(const VertexLayout& layout, const void* vertices, uint32_t vertexCount,
+             const uint32_t* indices = nullptr, uint32_t indexCount = 0);
+        // indices in the given format (cooked meshes use 16 bits when they fit)
+        Mesh(const VertexLayout& layout, const void* vertices, uint32_t vertexCount,
+             const void* indices, uint32_t indexCount, IndexFormat indexFormat);
+        ~Mesh();
+
+        Mesh(const Mesh&) = delete;
+        Mesh& operator=(const Mesh&) = delete;
+
+        unsigned int GetVertexArray() const { return m_VertexArray; }
+        const VertexLayout& GetLayout() const { return m_Layout; }
+        uint32_t GetVertexCount() const { return m_VertexCount; }
+        uint32_t GetIndexCount() const { return m_IndexCount; }
+        IndexFormat GetIndexFormat() const { return m_IndexFormat; }
+        bool IsIndexed() const { return m_IndexCount != 0; }
+        // GPU memory of both buffers
+        size_t GetSizeBytes() const;
+
+        static uint32_t GetIndexSize(IndexFormat format) { return format == IndexFormat::UInt16 ? 2 : 4; }
+    };
+
+}
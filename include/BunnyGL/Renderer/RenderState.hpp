@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+
+namespace BunnyGL {
+
+    class Shader;
+
+    enum class BlendMode : uint8_t {
+        None,
+        Alpha,              // src * a + dst * (1 - a)
+        Premultiplied,      // src + dst * (1 - a)
+        Additive            // src * a + dst
+    };
+
+    enum class CompareFunction : uint8_t {
+        Never,
+        Less,
+        Equal,
+        LessEqual,
+        Greater,
+        NotEqual,
+        GreaterEqual,
+        Always
+    };
+
+    enum class CullMode : uint8_t {
+        None,
+        Back,
+        Front
+    };
+
+    struct PipelineDescription {
+        Shader* Program = nullptr;
+        BlendMode Blend = BlendMode::None;
+        bool DepthTest = false;
+        bool DepthWrite = true;
+        CompareFunction DepthCompare = CompareFunction::Less;
+        CullMode Cull = CullMode::None;
+    };
+
+    // Immutable program + fixed-function state. Build once (e.g. in
+    // Scene::OnAttach) and bind with CommandList::BindPipeline; only the parts
+    // that differ from the current GL state are applied.
+    class PipelineState {
+    private:
+        PipelineDescription m_Description;
+
+    public:
+        PipelineState() = default;
+        explicit PipelineState(const PipelineDescription& description) : m_Description(description) {}
+
+        const PipelineDescription& GetDescription() const { return m_Description; }
+        Shader* GetShader() const { return m_Description.Program; }
+    };
+
+    // GL calls the cache was asked to make during one frame
+    struct RenderStateStats {
+        uint64_t Issued = 0;
+        uint64_t Skipped = 0;       // Already in the requested state
+    };
+
+    // Shadow copy of the GL binding and fixed-function state, so redundant
+    // calls never reach the driver. All renderer code binds through here; code
+    // that talks to GL directly (scene setup, command list callbacks) must call
+    // Invalidate() afterwards so the next request is issued unconditionally.
+    // Must be used from the thread that owns the GL context.
+    class RenderStateCache {
+    public:
+        static constexpr uint32_t MaxTextureUnits = 16;
+        static constexpr uint32_t MaxUniformBindings = 16;
+
+        // Forget everything; the next call of each kind goes to GL
+        static void Invalidate();
+
+        // Publishes the finished frame's counters and starts a new frame
+        static void BeginFrame();
+        // Last finished frame; safe from any thread
+        static RenderStateStats GetFrameStats();
+
+        static void UseProgram(uint32_t program);
+        static void BindVertexArray(uint32_t vertexArray);
+        // GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER (tracked per VAO by GL, so
+        // it is forgotten whenever the VAO changes), GL_UNIFORM_BUFFER
+        static void BindBuffer(uint32_t target, uint32_t buffer);
+        static void BindBufferRange(uint32_t binding, uint32_t buffer, uint64_t offset, uint64_t size);    // GL_UNIFORM_BUFFER
+        static void BindTexture(uint32_t unit, uint32_t target, uint32_t texture);
+
+        static void SetBlend(BlendMode mode);
+        static void SetDepth(bool test, bool write, CompareFunction compare);
+        static void SetDepthWrite(bool write);     // glClear honours the depth mask
+        static void SetCull(CullMode mode);
+        static void SetViewport(int x, int y, int width, int height);
+        static void SetClearColor(float r, float g, float b, float a);
+
+        static void ApplyPipeline(const PipelineState& pipeline);
+    };
+
+}
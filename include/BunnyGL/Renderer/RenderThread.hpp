@@ -0,0 +1,62 @@
+#pragma once
+#include <BunnyGL/Renderer/CommandList.hpp>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace BunnyGL {
+
+    class Window;
+
+    // Owns the GL context on a dedicated thread. The main thread records frame
+    // N+1 into one command list while this thread replays frame N from the
+    // other; SubmitFrame() waits for frame N before handing over N+1, so the
+    // renderer is never more than one frame behind.
+    class RenderThread {
+    public:
+        // Replays one frame (command list + swap) on the render thread; gets
+        // the profiler frame the list was recorded in
+        using FrameFunction = std::function<void(const CommandList&, uint32_t frame)>;
+
+    private:
+        Window& m_Window;
+        FrameFunction m_RenderFrame;
+        std::thread m_Thread;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_CV;
+        CommandList m_Lists[2];
+        uint32_t m_RecordIndex = 0;
+        const CommandList* m_Pending = nullptr;     // Submitted, not finished rendering
+        uint32_t m_PendingFrame = 0;
+        const std::function<void()>* m_Task = nullptr;
+        bool m_Stopping = false;
+
+    public:
+        // Takes the window's context away from the calling thread
+        RenderThread(Window& window, FrameFunction renderFrame);
+        // Finishes the last frame and hands the context back to the calling thread
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        // List the main thread records the next frame into
+        CommandList& GetRecordList() { return m_Lists[m_RecordIndex]; }
+
+        // Blocks until the previous frame is done, then queues the recorded list
+        void SubmitFrame(uint32_t frame);
+
+        // Runs task on the render thread once it is idle and waits for it
+        // (resource creation/destruction, read-backs)
+        void Execute(const std::function<void()>& task);
+
+        // Blocks until every submitted frame has been rendered
+        void WaitIdle();
+
+    private:
+        void ThreadLoop();
+    };
+
+}
@@ -1,17 +1,68 @@
 #pragma once
+#include <cstdint>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+#include <BunnyGL/Renderer/ShaderPreprocessor.hpp>
 #include <glm/glm.hpp>
 
 namespace BunnyGL {
+
+    // Value type of an active uniform, as reported by the driver at link time
+    enum class UniformType : uint8_t {
+        Unknown,
+        Int,        // int, bool
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Mat3,
+        Mat4,
+        Sampler     // Any sampler type, set with an int texture unit
+    };
+
+    // Index into a shader's uniform table. Resolve once with
+    // Shader::GetUniformHandle(), then set values without any name lookup.
+    // Only valid for the shader that returned it.
+    struct UniformHandle {
+        static constexpr uint16_t Invalid = 0xFFFF;
+        uint16_t Index = Invalid;
+
+        bool IsValid() const { return Index != Invalid; }
+    };
+
+    struct UniformInfo {
+        std::string Name;       // Without a trailing "[0]" for arrays
+        int Location;
+        UniformType Type;
+        int Count;              // Array size, 1 for plain uniforms
+    };
+
+    struct UniformBlockInfo {
+        std::string Name;
+        uint32_t Index;
+        uint32_t Size;          // GL_UNIFORM_BLOCK_DATA_SIZE
+        int Binding;            // -1 until assigned
+    };
+
     class Shader {
     private:
         unsigned int m_RendererID;
-        std::unordered_map<std::string, int> m_UniformLocationCache;
+        // Active default-block uniforms, filled once after linking
+        std::vector<UniformInfo> m_Uniforms;
+        // Handles whose type mismatch has already been reported
+        std::vector<bool> m_TypeErrorReported;
+        // Names that were looked up but do not exist (reported once)
+        std::vector<std::string> m_MissingUniforms;
+        // Active uniform blocks; blocks named after a UniformBinding are bound at link time
+        std::vector<UniformBlockInfo> m_UniformBlocks;
 
     public:
         // Constructors
-        Shader(const std::string& vertexPath, const std::string& fragmentPath);
+        // Sources go through the ShaderPreprocessor (#include, defines)
+        Shader(const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines = {});
+        // Takes ownership of a linked program
+        explicit Shader(unsigned int program);
         ~Shader();
 
         // Delete copy constructor/assignment (OpenGL resources can't be copied)
@@ -26,7 +77,30 @@ namespace BunnyGL {
         void Bind() const;
         void Unbind() const;
 
-        // Uniform setters
+        // Reflection. Unknown names return an invalid handle and are reported
+        // once; setting through an invalid handle is a no-op.
+        UniformHandle GetUniformHandle(std::string_view name);
+        const std::vector<UniformInfo>& GetUniforms() const { return m_Uniforms; }
+
+        // Uniform blocks. expectedSize (the C++ struct size, 0 = don't check) is
+        // compared against the std140 size the driver reports.
+        bool SetUniformBlockBinding(std::string_view name, uint32_t binding, uint32_t expectedSize = 0);
+        template<typename T>
+        bool BindUniformBlock(std::string_view name, uint32_t binding) {
+            return SetUniformBlockBinding(name, binding, static_cast<uint32_t>(sizeof(T)));
+        }
+        const std::vector<UniformBlockInfo>& GetUniformBlocks() const { return m_UniformBlocks; }
+
+        // Typed setters, checked against the reflected type
+        void SetUniform(UniformHandle handle, int value);
+        void SetUniform(UniformHandle handle, float value);
+        void SetUniform(UniformHandle handle, const glm::vec2& value);
+        void SetUniform(UniformHandle handle, const glm::vec3& value);
+        void SetUniform(UniformHandle handle, const glm::vec4& value);
+        void SetUniform(UniformHandle handle, const glm::mat3& value);
+        void SetUniform(UniformHandle handle, const glm::mat4& value);
+
+        // Name-based setters (search the uniform table on every call; prefer handles)
         void SetUniform1i(const std::string& name, int value);
         void SetUniform1f(const std::string& name, float value);
         void SetUniform2f(const std::string& name, float v0, float v1);
@@ -41,10 +115,18 @@ namespace BunnyGL {
         // Getter
         unsigned int GetRendererID() const { return m_RendererID; }
 
+        // Swaps in a newly linked program (hot reload) and deletes the old one.
+        // Existing UniformHandles keep referring to the same uniform names.
+        // Call on the GL thread between frames.
+        void ReplaceProgram(unsigned int program);
+
+        static void LogSourceFiles(const PreprocessedShader& vertex, const PreprocessedShader& fragment);
+
     private:
         // Helper methods
-        unsigned int CompileShader(unsigned int type, const std::string& source);
         unsigned int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
-        int GetUniformLocation(const std::string& name);
+        void Reflect();
+        // Table entry for handle if it exists and accepts values of type, else nullptr
+        const UniformInfo* Resolve(UniformHandle handle, UniformType type);
     };
 }
\ No newline at end of file
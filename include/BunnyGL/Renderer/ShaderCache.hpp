@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace BunnyGL {
+
+    struct ShaderCacheStats {
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;        // No entry for the key
+        uint64_t Rejected = 0;      // Entry existed but the driver refused the binary
+        uint64_t Stores = 0;
+        uint64_t Evictions = 0;
+        uint64_t BytesOnDisk = 0;
+    };
+
+    // On-disk cache of linked program binaries (glGetProgramBinary). Entries are
+    // keyed by a hash of the shader sources, defines and the driver's
+    // vendor/renderer/version strings, so a driver update simply misses. A
+    // binary the driver refuses is deleted and the caller compiles from source.
+    // The oldest entries are evicted once the directory exceeds the size cap.
+    // Must be used from the thread that owns the GL context.
+    class ShaderCache {
+    public:
+        // Disabled when the driver has no binary formats or directory is empty
+        static void Init(const std::string& directory = "shadercache", uint64_t maxBytes = 64ull * 1024 * 1024);
+        static void Shutdown();
+
+        static bool IsEnabled();
+
+        static uint64_t ComputeKey(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines = {});
+
+        // Linked program loaded from the cache, or 0 on a miss
+        static unsigned int Load(uint64_t key);
+        // Stores a linked program; it must have been linked with
+        // GL_PROGRAM_BINARY_RETRIEVABLE_HINT set (see PrepareProgram)
+        static void Store(uint64_t key, unsigned int program);
+        // Call on a new program before glLinkProgram
+        static void PrepareProgram(unsigned int program);
+
+        static ShaderCacheStats GetStats();
+    };
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace BunnyGL {
+
+    class Window;
+
+    // A program whose compile and link have been issued but not checked
+    struct ShaderCompileJob {
+        unsigned int Program = 0;
+        unsigned int Vertex = 0;
+        unsigned int Fragment = 0;
+        uint64_t CacheKey = 0;
+        bool FromCache = false;     // Program was restored from ShaderCache, nothing to check
+
+        bool IsValid() const { return Program != 0; }
+    };
+
+    // Splits program creation into Submit (issue compile + link, no status
+    // queries) and Finish (check status, report errors), so many programs can
+    // be in flight at once. With GL_KHR_parallel_shader_compile the driver
+    // compiles them on its own threads and IsComplete() reports progress;
+    // without it IsComplete() is always true and Finish() blocks for that one
+    // program, which still lets the caller spread the work over several frames.
+    // Must be used from the thread that owns the GL context.
+    class ShaderCompiler {
+    public:
+        static void Init(const Window& window);
+
+        static bool HasParallelCompile();
+
+        static ShaderCompileJob Submit(const std::string& vertexSource, const std::string& fragmentSource);
+        // Never blocks
+        static bool IsComplete(const ShaderCompileJob& job);
+        // Linked program (stored in ShaderCache) or 0 after logging the errors; job is consumed
+        static unsigned int Finish(ShaderCompileJob& job);
+        // Deletes everything the job created
+        static void Cancel(ShaderCompileJob& job);
+    };
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BunnyGL {
+
+    struct ShaderDefine {
+        std::string Name;
+        std::string Value;      // Empty for a plain #define NAME
+    };
+    using ShaderDefines = std::vector<ShaderDefine>;
+
+    struct PreprocessedShader {
+        std::string Source;
+        // Every file that went into Source; index N is GLSL source string N in
+        // #line directives and therefore in compiler messages
+        std::vector<std::string> Files;
+        uint64_t Hash = 0;          // Of Source, so equal hashes mean identical programs
+        bool Success = false;
+    };
+
+    // GLSL front end: resolves #include "file" (relative to the including
+    // file, then to the include directories), honours #pragma once, and
+    // injects a define set right after #version to build a permutation
+    // variant. The result is content-hashed so identical variants, whatever
+    // file or define order produced them, are compiled only once.
+    class ShaderPreprocessor {
+    public:
+        static PreprocessedShader Process(const std::string& path, const ShaderDefines& defines = {});
+
+        // Searched after the including file's directory
+        static void AddIncludeDirectory(const std::string& directory);
+    };
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+// C++ types that reproduce GLSL std140 alignment, so a struct built from them
+// can be memcpy'd straight into a uniform block:
+//
+//   struct ObjectUniforms {                    layout(std140) uniform Object {
+//       Std140::Mat4 Transform;                    mat4 u_Transform;
+//       Std140::Vec4 Tint;                         vec4 u_Tint;
+//       Std140::Float Roughness;                   float u_Roughness;
+//   };                                         };
+//
+// vec3 is padded to 16 bytes here, so a float that GLSL would pack into a
+// vec3's fourth component needs an explicit member order (put it first).
+// Verify layouts with BG_STD140_OFFSET and Shader::BindUniformBlock<T>().
+
+namespace BunnyGL::Std140 {
+
+    using Float = float;
+    using Int = int32_t;
+    using UInt = uint32_t;
+
+    // GLSL bool is 4 bytes
+    struct Bool {
+        uint32_t Value = 0;
+        Bool() = default;
+        Bool(bool value) : Value(value ? 1u : 0u) {}
+        Bool& operator=(bool value) { Value = value ? 1u : 0u; return *this; }
+    };
+
+    struct alignas(8) Vec2 {
+        glm::vec2 Value{0.0f};
+        Vec2() = default;
+        Vec2(const glm::vec2& value) : Value(value) {}
+        Vec2& operator=(const glm::vec2& value) { Value = value; return *this; }
+    };
+
+    struct alignas(16) Vec3 {
+        glm::vec3 Value{0.0f};
+        float Padding = 0.0f;
+        Vec3() = default;
+        Vec3(const glm::vec3& value) : Value(value) {}
+        Vec3& operator=(const glm::vec3& value) { Value = value; return *this; }
+    };
+
+    struct alignas(16) Vec4 {
+        glm::vec4 Value{0.0f};
+        Vec4() = default;
+        Vec4(const glm::vec4& value) : Value(value) {}
+        Vec4& operator=(const glm::vec4& value) { Value = value; return *this; }
+    };
+
+    // Columns are vec4-aligned in std140
+    struct alignas(16) Mat3 {
+        glm::vec4 Columns[3] = {};
+        Mat3() = default;
+        Mat3(const glm::mat3& value) { *this = value; }
+        Mat3& operator=(const glm::mat3& value) {
+            for (int i = 0; i < 3; ++i) Columns[i] = glm::vec4(value[i], 0.0f);
+            return *this;
+        }
+    };
+
+    struct alignas(16) Mat4 {
+        glm::mat4 Value{1.0f};
+        Mat4() = default;
+        Mat4(const glm::mat4& value) : Value(value) {}
+        Mat4& operator=(const glm::mat4& value) { Value = value; return *this; }
+    };
+
+    // Array elements are rounded up to 16 bytes, so float[4] in GLSL is
+    // Std140::Array<Std140::Float, 4> here
+    template<typename T>
+    struct alignas(16) ArrayElement {
+        T Value{};
+    };
+
+    template<typename T, size_t N>
+    struct Array {
+        ArrayElement<T> Elements[N];
+        T& operator[](size_t i) { return Elements[i].Value; }
+        const T& operator[](size_t i) const { return Elements[i].Value; }
+    };
+
+    static_assert(sizeof(Vec3) == 16 && sizeof(Mat3) == 48 && sizeof(Mat4) == 64, "Unexpected std140 type size");
+
+}
+
+// Compile-time check of a member's std140 offset
+#define BG_STD140_OFFSET(type, member, offset) \
+    static_assert(offsetof(type, member) == (offset), #type "::" #member " is not at std140 offset " #offset)
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace BunnyGL {
+
+    enum class TextureFormat : uint8_t {
+        R8,
+        RG8,
+        RGB8,
+        RGBA8
+    };
+
+    struct TextureSpecification {
+        uint32_t Width = 1;
+        uint32_t Height = 1;
+        TextureFormat Format = TextureFormat::RGBA8;
+        bool Mipmaps = true;
+        bool Linear = true;     // Filtering; false for nearest
+        bool Repeat = true;     // Wrapping; false clamps to edge
+    };
+
+    // Immutable-size 2D texture. Create, update and destroy on the GL thread.
+    class Texture2D {
+    private:
+        unsigned int m_RendererID = 0;
+        TextureSpecification m_Specification;
+
+        void CreateTexture();
+
+    public:
+        // pixels: tightly packed rows, bottom row first; null leaves the texture uninitialized
+        Texture2D(const TextureSpecification& specification, const void* pixels = nullptr);
+        // Precomputed mip chain (cooked textures): levels[i] is level i, each
+        // level half the size of the one before, down to at most 1x1. Nothing
+        // is generated on the GPU; specification.Mipmaps is set from levelCount.
+        Texture2D(const TextureSpecification& specification, const void* const* levels, uint32_t levelCount);
+        ~Texture2D();
+
+        Texture2D(const Texture2D&) = delete;
+        Texture2D& operator=(const Texture2D&) = delete;
+
+        // Replaces the whole image and regenerates mipmaps
+        void SetData(const void* pixels);
+        void Bind(uint32_t unit) const;
+
+        unsigned int GetRendererID() const { return m_RendererID; }
+        const TextureSpecification& GetSpecification() const { return m_Specification; }
+        uint32_t GetWidth() const { return m_Specification.Width; }
+        uint32_t GetHeight() const { return m_Specification.Height; }
+        // GPU memory, including the mip chain
+        size_t GetSizeBytes() const;
+
+        static uint32_t GetBytesPerPixel(TextureFormat format);
+        // Levels in a full chain down to 1x1
+        static uint32_t GetMipCount(uint32_t width, uint32_t height);
+    };
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <BunnyGL/Renderer/Std140.hpp>
+#include <cstdint>
+#include <string_view>
+
+namespace BunnyGL {
+
+    // Binding points for the shared blocks. Shaders that declare a uniform block
+    // with one of these names get the binding assigned automatically at link time.
+    namespace UniformBinding {
+        constexpr uint32_t Frame = 0;       // "Frame": FrameUniforms, bound by Application
+        constexpr uint32_t View = 1;        // "View": camera data, bound by the scene
+        constexpr uint32_t Object = 2;      // "Object": per-draw data
+        constexpr uint32_t FirstCustom = 3;
+
+        // -1 for names without a reserved binding
+        inline int FromBlockName(std::string_view name) {
+            if (name == "Frame") return static_cast<int>(Frame);
+            if (name == "View") return static_cast<int>(View);
+            if (name == "Object") return static_cast<int>(Object);
+            return -1;
+        }
+    }
+
+    // layout(std140) uniform Frame { float u_Time; float u_DeltaTime; vec2 u_Resolution; uint u_FrameIndex; };
+    struct FrameUniforms {
+        Std140::Float Time;
+        Std140::Float DeltaTime;
+        Std140::Vec2 Resolution;
+        Std140::UInt FrameIndex;
+    };
+    BG_STD140_OFFSET(FrameUniforms, Resolution, 8);
+    BG_STD140_OFFSET(FrameUniforms, FrameIndex, 16);
+
+    // Block data allocated from a CommandList; Offset is relative to that
+    // list's uniform data until the list is uploaded
+    struct UniformAllocation {
+        uint32_t Offset = 0;
+        uint32_t Size = 0;
+
+        bool IsValid() const { return Size != 0; }
+    };
+
+    // One GL uniform buffer split into FramesInFlight regions. Each frame, a
+    // command list's block data goes into the next region with a single
+    // unsynchronized write, and draws bind their slice with glBindBufferRange.
+    // A fence per region keeps the CPU from overwriting data the GPU still reads.
+    // Must be used from the thread that owns the GL context.
+    class UniformArena {
+    public:
+        static constexpr uint32_t FramesInFlight = 3;
+
+        static void Init(uint32_t bytesPerFrame = 4 * 1024 * 1024);
+        static void Shutdown();
+
+        // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT (256 until Init); safe from any thread
+        static uint32_t GetOffsetAlignment();
+
+        // Writes one frame's worth of block data into the next region and
+        // returns its offset in the buffer. Regions grow (by reallocating the
+        // buffer) when a frame needs more than bytesPerFrame.
+        static uint32_t Upload(const void* data, uint32_t size);
+
+        // Fences the region written by the last Upload
+        static void EndFrame();
+
+        static uint32_t GetBuffer();
+    };
+
+}
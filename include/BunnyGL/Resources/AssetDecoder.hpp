@@ -0,0 +1,44 @@
+#pragma once
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BunnyGL {
+
+    // Decoded image, ready for Texture2D: tightly packed, bottom row first
+    struct ImageData {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        TextureFormat Format = TextureFormat::RGBA8;
+        std::vector<uint8_t> Pixels;
+    };
+
+    // Decoded mesh, ready for Mesh
+    struct MeshData {
+        VertexLayout Layout;
+        std::vector<float> Vertices;
+        std::vector<uint32_t> Indices;
+        uint32_t VertexCount = 0;
+    };
+
+    // CPU-side file format decoding, with no GL calls, so it can run on any
+    // thread. On failure, error says why.
+    class AssetDecoder {
+    public:
+        // Binary PGM/PPM (P5, P6, 8 bit) and TGA (uncompressed or RLE; 8-bit grey, 24 or 32 bit colour)
+        static bool DecodeImage(std::string_view data, ImageData& image, std::string& error);
+
+        // Wavefront OBJ: positions, texture coordinates and normals; polygons are
+        // fanned into triangles and identical corners share a vertex. Layout:
+        // location 0 position (vec3), 1 normal (vec3), 2 texture coordinate (vec2).
+        static bool DecodeMesh(std::string_view data, MeshData& mesh, std::string& error);
+
+        // Lower-case extension without the dot
+        static bool IsImageExtension(std::string_view extension);
+        static bool IsMeshExtension(std::string_view extension);
+    };
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace BunnyGL {
+
+    // What a load hands back to the GL thread
+    struct AssetUpload {
+        std::function<void()> Apply;    // Creates the GL objects; runs on the GL thread
+        size_t Bytes = 0;               // Counted against the per-frame upload budget
+    };
+
+    struct AssetLoaderStats {
+        size_t Loading = 0;             // Queued or being read and decoded
+        size_t WaitingForUpload = 0;
+        uint64_t Uploaded = 0;
+        uint64_t BytesUploaded = 0;
+        uint64_t BytesUploadedLastFrame = 0;
+    };
+
+    // Streams assets in without stalling the frame. Loader threads do the file
+    // I/O and decoding; the finished results wait in a completion queue until
+    // the GL thread applies them with ProcessUploads, a few per frame, within a
+    // time and byte budget. Dedicated threads rather than the JobSystem, so
+    // blocking reads never occupy a compute worker.
+    class AssetLoader {
+    public:
+        using LoadFunction = std::function<AssetUpload()>;
+
+        static void Init(uint32_t threadCount = 2);
+        // Queued loads and unapplied uploads are dropped
+        static void Shutdown();
+        static bool IsRunning();
+
+        // Runs load on a loader thread (on the calling thread before Init)
+        static void Enqueue(LoadFunction load);
+
+        // GL thread, once per frame. Applies finished loads in completion order
+        // until budgetMs or budgetBytes is spent, always at least one. Returns how many.
+        static size_t ProcessUploads(double budgetMs, size_t budgetBytes);
+        // GL thread. Blocks until everything queued so far is applied.
+        static void Flush();
+
+        static AssetLoaderStats GetStats();
+    };
+
+}
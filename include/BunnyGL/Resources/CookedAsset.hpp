@@ -0,0 +1,87 @@
+#pragma once
+#include <BunnyGL/Renderer/Buffer.hpp>
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BunnyGL {
+
+    struct ImageData;
+    struct MeshData;
+
+    // Cooked texture (.bgtex), little-endian:
+    //   CookedTextureHeader
+    //   uint64_t offsets[MipCount]     from the start of the blob
+    //   levels                         tightly packed, bottom row first, 16-byte aligned
+    struct CookedTextureHeader {
+        char Magic[4];                  // "BGTX"
+        uint32_t Version;
+        uint32_t Width;
+        uint32_t Height;
+        uint32_t Format;                // TextureFormat
+        uint32_t MipCount;
+    };
+
+    // Cooked mesh (.bgmesh), little-endian:
+    //   CookedMeshHeader
+    //   VertexAttribute[AttributeCount]
+    //   vertices                       interleaved, Stride bytes each, 16-byte aligned
+    //   indices                        IndexFormat, 16-byte aligned
+    struct CookedMeshHeader {
+        char Magic[4];                  // "BGMS"
+        uint32_t Version;
+        uint32_t VertexCount;
+        uint32_t IndexCount;
+        uint32_t IndexFormat;           // IndexFormat
+        uint32_t Stride;
+        uint32_t AttributeCount;
+        uint32_t Reserved;
+        uint64_t VertexOffset;          // From the start of the blob
+        uint64_t IndexOffset;
+    };
+
+    // Views into a cooked blob: valid as long as the blob is
+    struct CookedTexture {
+        TextureFormat Format = TextureFormat::RGBA8;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<const void*> Levels;
+    };
+
+    struct CookedMesh {
+        VertexLayout Layout;
+        uint32_t VertexCount = 0;
+        uint32_t IndexCount = 0;
+        IndexFormat Indices = IndexFormat::UInt32;
+        const void* VertexData = nullptr;
+        const void* IndexData = nullptr;
+        size_t VertexBytes = 0;
+        size_t IndexBytes = 0;
+    };
+
+    // Runtime-native asset blobs, written offline by bunnygl-cook. Everything
+    // the runtime would otherwise compute (decoding, the mip chain, the index
+    // format) is done once when cooking; loading a cooked asset parses a header
+    // and hands views of the blob straight to GL.
+    class CookedAsset {
+    public:
+        static constexpr uint32_t Version = 1;
+
+        // Offline: builds the blob. mipmaps = include the full mip chain (box filtered).
+        static std::string CookTexture(const ImageData& image, bool mipmaps = true);
+        // Offline: 16-bit indices when every index fits, else 32-bit
+        static std::string CookMesh(const MeshData& mesh);
+
+        // Runtime: validates the header and fills in views into blob
+        static bool ReadTexture(std::string_view blob, CookedTexture& texture, std::string& error);
+        static bool ReadMesh(std::string_view blob, CookedMesh& mesh, std::string& error);
+
+        // Lower-case extension without the dot
+        static bool IsTextureExtension(std::string_view extension) { return extension == "bgtex"; }
+        static bool IsMeshExtension(std::string_view extension) { return extension == "bgmesh"; }
+    };
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+namespace BunnyGL {
+
+    struct EmbeddedFile {
+        std::string_view Path;          // "resources/shaders/Planet.vert"
+        const unsigned char* Data;      // Followed by a 0 byte
+        size_t Size;
+
+        std::string_view GetView() const { return { reinterpret_cast<const char*>(Data), Size }; }
+    };
+
+    // Files compiled into the binary. The build turns the files listed in
+    // BUNNYGL_EMBEDDED_RESOURCES into constexpr byte arrays (see
+    // cmake/EmbedResources.cmake), so they need no file I/O and don't depend
+    // on the working directory. FileSystem looks here before archives and disk.
+    class EmbeddedResources {
+    public:
+        // Sorted by path; defined by the generated source
+        static const EmbeddedFile* GetFiles();
+        static size_t GetCount();
+
+        // Contents of path; a null view (data() == nullptr) if it isn't embedded
+        static std::string_view Find(std::string_view path);
+        static bool Contains(std::string_view path) { return Find(path).data() != nullptr; }
+    };
+
+}
@@ -1,38 +1,100 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <fstream>
-#include <sstream>
+#include <string_view>
 
 namespace BunnyGL {
 
+    // How a mapping will be read; passed to the kernel as an madvise hint
+    enum class FileAccess {
+        Normal,
+        Sequential,     // Read front to back once (decoders): aggressive read-ahead
+        Random,         // Scattered lookups: no read-ahead
+        WillNeed        // Start paging everything in now
+    };
+
+    // Read-only memory mapping of a whole file (RAII). The contents are paged
+    // in on demand and never copied. Where mmap isn't available the file is
+    // read into an internal buffer instead, behind the same interface. Files
+    // that may be truncated while open are better read with ReadInto: touching
+    // a mapped page past the new end faults (SIGBUS).
+    class MappedFile {
+    private:
+        const char* m_Data = nullptr;
+        size_t m_Size = 0;
+        bool m_Open = false;
+        bool m_Mapped = false;      // m_Data needs munmap
+#if !defined(__unix__) && !defined(__APPLE__)
+        std::string m_Buffer;
+#endif
+
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& path, FileAccess access = FileAccess::Sequential) { Open(path, access); }
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps the file on disk (archives are not consulted; see FileSystem::ReadView)
+        bool Open(const std::string& path, FileAccess access = FileAccess::Sequential);
+        void Close();
+        void Advise(FileAccess access) const;
+
+        // Empty files are open with a size of 0
+        bool IsOpen() const { return m_Open; }
+        const char* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+        std::string_view GetView() const { return { m_Data, m_Size }; }
+    };
+
     class FileSystem {
     public:
 
         // Read entire file into string
-        static std::string ReadFile(const std::string& filepath) {
-            std::ifstream file(filepath, std::ios::in | std::ios::binary);
-            if (!file.is_open()) {
-                return "";
-            }
-
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            return buffer.str();
-        }
-
-        // Check if file exists
-        static bool FileExists(const std::string& filepath) {
-            std::ifstream file(filepath);
-            return file.good();
-        }
-
-        // Get file extension
-        static std::string GetExtension(const std::string& filepath) {
-            size_t dotPos = filepath.find_last_of('.');
-            if (dotPos == std::string::npos) {
-                return "";
-            }
-            return filepath.substr(dotPos + 1);
-        }
+        static std::string ReadFile(const std::string& filepath);
+        // Reads filepath into buffer, reusing its capacity; false (buffer
+        // emptied) if the file can't be read
+        static bool ReadInto(const std::string& filepath, std::string& buffer);
+        // Contents of filepath without a copy: a view into embedded data or a
+        // mounted archive, or else into file mapped by this call. Valid while file
+        // is open (and the archives stay mounted). A null view (data() == nullptr)
+        // if missing.
+        static std::string_view ReadView(const std::string& filepath, MappedFile& file,
+                                         FileAccess access = FileAccess::Sequential);
+
+        // Check if file exists (stat, no open)
+        static bool FileExists(const std::string& filepath);
+        // Size in bytes, or -1 if the file doesn't exist
+        static int64_t GetFileSize(const std::string& filepath);
+
+        // Path helpers; the results view into filepath
+        // "a/b.tar.gz" -> "gz" (no dot), "" without an extension
+        static std::string_view GetExtension(std::string_view filepath);
+        // "a/b.tar.gz" -> "b.tar.gz"
+        static std::string_view GetFileName(std::string_view filepath);
+        // "a/b.tar.gz" -> "b.tar"
+        static std::string_view GetStem(std::string_view filepath);
+        // "a/b.tar.gz" -> "a", "" for a bare file name
+        static std::string_view GetDirectory(std::string_view filepath);
+
+        // The read and query functions above look in memory before the disk: first
+        // the files compiled into the binary (see EmbeddedResources), then the
+        // packed archives (see PackArchive), the most recently mounted first.
+        // Mount during startup, before loads are in flight.
+        static bool MountArchive(const std::string& archivePath);
+        static void UnmountArchives();
+        static bool HasMountedArchives();
+        // Off = embedded files are skipped (hot reload edits the files on disk)
+        static void SetUseEmbedded(bool enabled);
+        static bool IsUsingEmbedded();
+
+        // Contents of filepath viewed straight out of embedded data or a mounted
+        // archive, without a copy; a null view (data() == nullptr) if neither has
+        // it. Archive views are valid until UnmountArchives.
+        static std::string_view ReadPacked(std::string_view filepath);
     };
-}
\ No newline at end of file
+}
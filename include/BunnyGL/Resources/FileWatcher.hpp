@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace BunnyGL {
+
+    // Watches individual files for changes on a background thread and reports
+    // them in batches. Linux uses inotify on the containing directories, so
+    // editors that save by writing a temporary file and renaming it over the
+    // original are caught too; elsewhere the files' modification times are
+    // polled. Events arriving within a short settle time are coalesced, so one
+    // save produces one notification.
+    class FileWatcher {
+    public:
+        // Called on the watcher thread with each batch of changed paths
+        using ChangeCallback = std::function<void(const std::vector<std::string>& paths)>;
+
+    private:
+        ChangeCallback m_Callback;
+        std::thread m_Thread;
+        std::atomic<bool> m_Running{false};
+
+        std::mutex m_Mutex;
+        std::unordered_set<std::string> m_Files;            // Normalized paths
+        std::unordered_map<std::string, int> m_Directories; // Directory -> inotify watch descriptor
+        std::unordered_map<std::string, int64_t> m_ModifiedTimes;  // Polling fallback
+
+        int m_INotify = -1;
+        int m_WakePipe[2] = { -1, -1 };
+
+    public:
+        explicit FileWatcher(ChangeCallback callback);
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        void Watch(const std::string& path);
+        void Unwatch(const std::string& path);
+
+    private:
+        void ThreadLoop();
+        void Wake();
+    };
+
+}
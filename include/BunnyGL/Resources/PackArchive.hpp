@@ -0,0 +1,83 @@
+#pragma once
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace BunnyGL {
+
+    // On-disk layout of a .bgpak file, all little-endian:
+    //   PackHeader
+    //   PackEntry[EntryCount]      sorted by path (byte order)
+    //   path strings               not null-terminated
+    //   blobs                      each aligned to PackHeader::Alignment
+    struct PackHeader {
+        char Magic[4];              // "BGPK"
+        uint32_t Version;
+        uint32_t EntryCount;
+        uint32_t Alignment;
+        uint64_t StringsOffset;
+        uint64_t StringsSize;
+        uint64_t FileSize;          // Catches truncated archives
+    };
+
+    struct PackEntry {
+        uint32_t PathOffset;        // Into the string table
+        uint32_t PathLength;
+        uint64_t DataOffset;        // From the start of the file
+        uint64_t Size;
+        uint64_t Hash;              // Hash64 of the contents
+    };
+
+    // Read-only archive of many files in one. The file is memory-mapped once
+    // and lookups are a binary search over the table of contents that return
+    // views straight into the mapping: no open, read or copy per asset. Views
+    // stay valid until the archive is closed or destroyed. Lookups are thread-safe.
+    class PackArchive {
+    private:
+        MappedFile m_File;
+        const PackEntry* m_Entries = nullptr;
+        uint32_t m_EntryCount = 0;
+        const char* m_Strings = nullptr;
+        std::string m_Path;
+
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr uint32_t DefaultAlignment = 16;
+
+        PackArchive() = default;
+
+        PackArchive(const PackArchive&) = delete;
+        PackArchive& operator=(const PackArchive&) = delete;
+
+        // Maps the archive and checks the header and table of contents
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return m_File.IsOpen(); }
+        const std::string& GetPath() const { return m_Path; }
+
+        // Entry for path ("resources/shaders/Planet.vert"), or nullptr
+        const PackEntry* Find(std::string_view path) const;
+        // Contents of path; a null view (data() == nullptr) if it isn't packed
+        std::string_view Read(std::string_view path) const;
+        bool Contains(std::string_view path) const { return Find(path) != nullptr; }
+
+        std::string_view GetData(const PackEntry& entry) const { return { m_File.GetData() + entry.DataOffset, static_cast<size_t>(entry.Size) }; }
+        std::string_view GetEntryPath(const PackEntry& entry) const { return { m_Strings + entry.PathOffset, entry.PathLength }; }
+        uint32_t GetEntryCount() const { return m_EntryCount; }
+        const PackEntry& GetEntry(uint32_t index) const { return m_Entries[index]; }
+
+        // Rehashes the contents; touches every page, so not done by Open
+        bool Verify(const PackEntry& entry) const;
+        bool VerifyAll() const;
+
+        // Packs every file under directory; entry paths are the file paths
+        // relative to the working directory with '/' separators, so they match
+        // what the engine passes to FileSystem. Written to a temporary file
+        // and renamed, so a failed build never leaves a truncated archive.
+        static bool Build(const std::string& directory, const std::string& outputPath,
+                          std::string& error, uint32_t alignment = DefaultAlignment);
+    };
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+namespace BunnyGL {
+
+    // 32-bit reference to a resource in a ResourcePool: a slot index plus the
+    // generation the slot had when the resource was added. Destroying the
+    // resource bumps the slot's generation, so stale handles resolve to nullptr
+    // instead of to whatever reuses the slot. The zero value is never issued.
+    template<typename T>
+    class ResourceHandle {
+    public:
+        static constexpr uint32_t IndexBits = 20;
+        static constexpr uint32_t GenerationBits = 32 - IndexBits;
+        static constexpr uint32_t MaxIndex = (1u << IndexBits) - 1;
+        static constexpr uint32_t MaxGeneration = (1u << GenerationBits) - 1;
+
+    private:
+        uint32_t m_Value = 0;
+
+    public:
+        ResourceHandle() = default;
+        ResourceHandle(uint32_t index, uint32_t generation) : m_Value((generation << IndexBits) | (index & MaxIndex)) {}
+
+        bool IsValid() const { return m_Value != 0; }
+        explicit operator bool() const { return IsValid(); }
+
+        uint32_t GetIndex() const { return m_Value & MaxIndex; }
+        uint32_t GetGeneration() const { return m_Value >> IndexBits; }
+        uint32_t GetValue() const { return m_Value; }
+
+        bool operator==(ResourceHandle other) const { return m_Value == other.m_Value; }
+        bool operator!=(ResourceHandle other) const { return m_Value != other.m_Value; }
+    };
+
+    class Shader;
+    class Texture2D;
+    class Mesh;
+    class Buffer;
+
+    using ShaderHandle = ResourceHandle<Shader>;
+    using TextureHandle = ResourceHandle<Texture2D>;
+    using MeshHandle = ResourceHandle<Mesh>;
+    using BufferHandle = ResourceHandle<Buffer>;
+
+}
+
+namespace std {
+    template<typename T>
+    struct hash<BunnyGL::ResourceHandle<T>> {
+        size_t operator()(BunnyGL::ResourceHandle<T> handle) const { return std::hash<uint32_t>()(handle.GetValue()); }
+    };
+}
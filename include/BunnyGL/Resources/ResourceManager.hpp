@@ -1,4 +1,9 @@
 #pragma once
+#include <BunnyGL/Renderer/ShaderCompiler.hpp>
+#include <BunnyGL/Renderer/ShaderPreprocessor.hpp>
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <BunnyGL/Resources/ResourcePool.hpp>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -7,22 +12,174 @@
 
 namespace BunnyGL {
 
-    class Shader;
+    class FileWatcher;
 
+    struct ShaderSource {
+        std::string Name;
+        std::string VertexPath;
+        std::string FragmentPath;
+        ShaderDefines Defines;
+    };
+
+    struct ShaderLibraryStats {
+        uint64_t Requests = 0;      // Shader loads that needed a program
+        uint64_t Deduplicated = 0;  // Of those, served by an existing identical program
+        size_t Programs = 0;        // Distinct live programs
+    };
+
+    // Handle to a shader that is still compiling. Cheap to copy; can be polled
+    // from any thread.
+    class ShaderFuture {
+    public:
+        enum class Status : int { Pending, Ready, Failed };
+
+    private:
+        struct State {
+            std::string Name;
+            ShaderHandle Result;                // Written before Current becomes Ready
+            std::atomic<ShaderFuture::Status> Current{ShaderFuture::Status::Pending};
+        };
+        std::shared_ptr<State> m_State;
+
+        friend class ResourceManager;
+
+    public:
+        ShaderFuture() = default;
+
+        bool IsValid() const { return m_State != nullptr; }
+        Status GetStatus() const { return m_State ? m_State->Current.load(std::memory_order_acquire) : Status::Failed; }
+        bool IsReady() const { return GetStatus() == Status::Ready; }
+        bool IsFailed() const { return GetStatus() == Status::Failed; }
+
+        // Invalid until ready
+        ShaderHandle Get() const { return IsReady() ? m_State->Result : ShaderHandle(); }
+        const std::string& GetName() const { return m_State->Name; }
+    };
+
+    // Registry of GPU resources. Each type lives in a ResourcePool: lookups by
+    // handle or name take only a shared lock and hand out raw pointers, so
+    // worker threads can resolve resources concurrently without refcounting.
+    // Resources live until explicitly unloaded or destroyed, which (like
+    // loading) happens on the GL thread.
     class ResourceManager {
 
     private:
-        static std::unordered_map<std::string, std::shared_ptr<Shader>> m_Shaders;
+        struct PendingShader {
+            uint64_t SourceHash;
+            ShaderCompileJob Job;
+            std::vector<ShaderFuture> Futures;      // Every request for this exact source
+            PreprocessedShader Vertex;              // Kept for error reporting
+            PreprocessedShader Fragment;
+            ShaderDefines Defines;
+        };
+
+        // Where a live program came from, for hot reload
+        struct ShaderRecord {
+            ShaderHandle Program;
+            std::string VertexPath;
+            std::string FragmentPath;
+            ShaderDefines Defines;
+            std::vector<std::string> Files;         // Both stages, includes too
+            uint64_t SourceHash;
+        };
+
+        // A changed program, preprocessed on the watcher thread and compiled
+        // on the GL thread by PollShaders
+        struct ShaderReload {
+            ShaderHandle Target;
+            uint64_t SourceHash;
+            PreprocessedShader Vertex;
+            PreprocessedShader Fragment;
+            ShaderCompileJob Job;
+            bool Submitted = false;
+        };
+
+        static ResourcePool<Shader> m_Shaders;
+        static ResourcePool<Texture2D> m_Textures;
+        static ResourcePool<Mesh> m_Meshes;
+        static ResourcePool<Buffer> m_Buffers;
+
+        // Programs by preprocessed source hash; names with identical sources share one
+        static std::unordered_map<uint64_t, ShaderHandle> m_ShadersBySource;
+        static ShaderLibraryStats m_ShaderStats;
+        static std::vector<ShaderFuture> m_PreprocessingShaders;   // On the loader threads
+        static std::vector<PendingShader> m_PendingShaders;
+        static std::vector<ShaderRecord> m_ShaderRecords;
+        static std::vector<ShaderReload> m_ShaderReloads;
+        static std::unique_ptr<FileWatcher> m_ShaderWatcher;
+        // Guards the shader bookkeeping above; lookups only take the pool's lock
         static std::mutex m_ShaderMutex;
 
     public:
         // Shader management
-        static std::shared_ptr<Shader> LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
-        static std::shared_ptr<Shader> GetShader(const std::string& name);
+        // Sources are preprocessed first; a name whose final sources match an
+        // already loaded shader gets that same program
+        static ShaderHandle LoadShader(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+                                       const ShaderDefines& defines = {});
+        static ShaderHandle GetShader(const std::string& name);
         static bool HasShader(const std::string& name);
+        // Drops a name; the program is deleted with its last name
+        static void UnloadShader(const std::string& name);
+
+        // Batch loading: sources are read and preprocessed on the AssetLoader
+        // threads, every compile and link is then issued without waiting on
+        // any of them, and PollShaders finishes them as the driver completes
+        // them. Call from the GL thread (Scene::OnAttach); the application
+        // applies uploads and polls once per frame.
+        static std::vector<ShaderFuture> LoadShaders(const std::vector<ShaderSource>& sources);
+        static ShaderFuture LoadShaderAsync(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+                                            const ShaderDefines& defines = {});
+        // Finishes completed programs and hot reloads, spending at most about
+        // budgetMs when the driver compiles synchronously. Returns how many finished.
+        static size_t PollShaders(double budgetMs = 2.0);
+        // Blocks until every pending shader is finished
+        static void FinishShaders();
+        static size_t GetPendingShaderCount();
+
+        // Asynchronous loads through the AssetLoader. The handle is valid at
+        // once and resolves to nullptr (state Loading) until the data has been
+        // read, decoded and uploaded; then Ready, or Failed. The path is the
+        // name, so loading a path twice returns the same handle. Cooked assets
+        // (.bgtex, .bgmesh; see CookedAsset) skip decoding and upload straight
+        // from the mapped file.
+        static TextureHandle LoadTexture(const std::string& path, const TextureSpecification& sampling = {});
+        static MeshHandle LoadMesh(const std::string& path);
+
+        // Hot reload: loaded shader files (and their includes) are watched on a
+        // background thread. A changed program is recompiled without blocking
+        // the frame and swapped into the existing Shader by PollShaders, at a
+        // frame boundary; if it fails to build, the old program stays.
+        static void SetShaderHotReload(bool enabled);
+        static bool IsShaderHotReloadEnabled();
+
+        // Textures, meshes and buffers are created by the caller and handed
+        // over under a unique name (or none). Shaders work here too.
+        template<typename T> static ResourceHandle<T> Add(const std::string& name, std::unique_ptr<T> resource);
+        template<typename T> static ResourceHandle<T> Find(const std::string& name);
+        // nullptr once the resource is destroyed, and while it is loading or
+        // evicted; an evicted resource starts reloading. Valid until destroyed
+        // or evicted, which never happens to a resource used this frame or the last.
+        template<typename T> static T* Get(ResourceHandle<T> handle);
+        // Deletes the resource now and invalidates every handle and name for it
+        template<typename T> static bool Destroy(ResourceHandle<T> handle);
+        template<typename T> static ResourceState GetState(ResourceHandle<T> handle);
+        template<typename T> static size_t GetCount();
+
+        // Residency: every pool tracks the size of its resources and the frame
+        // each was last resolved. Past a class's budget, the least recently used
+        // resources that were loaded from files (LoadTexture, LoadMesh) are
+        // evicted and come back through the AssetLoader on their next Get.
+        // Resources added directly can't be reloaded and are never evicted.
+        template<typename T> static void SetMemoryBudget(uint64_t bytes);   // 0 = unlimited
+        template<typename T> static ResidencyStats GetResidencyStats();
+        // Main thread, before the scene records the frame
+        static void BeginFrame(uint64_t frameIndex);
+        // GL thread, between frames. Returns how many resources were evicted.
+        static size_t EnforceMemoryBudgets();
 
         // Get all loaded shader names
         static std::vector<std::string> GetLoadedShaders();
+        static ShaderLibraryStats GetShaderStats();
 
         // Cleanup
         static void ClearShaders();
@@ -32,5 +189,22 @@ namespace BunnyGL {
         ResourceManager() = delete;
         ResourceManager(const ResourceManager&) = delete;
         ResourceManager& operator=(const ResourceManager&) = delete;
+
+    private:
+        // Callers hold m_ShaderMutex
+        static ShaderHandle FindBySource(uint64_t sourceHash);
+        static ShaderHandle FinishPending(PendingShader& pending);
+        static void TrackShader(ShaderHandle shader, const PreprocessedShader& vertex, const PreprocessedShader& fragment,
+                                const ShaderDefines& defines, uint64_t sourceHash);
+        static void FinishReload(ShaderReload& reload);
+        // Loader side of LoadTexture/LoadMesh, also used to reload evicted resources
+        static void EnqueueTextureLoad(TextureHandle handle, const std::string& path, const TextureSpecification& sampling);
+        static void EnqueueMeshLoad(MeshHandle handle, const std::string& path);
+        // GL thread, from the AssetLoader upload queue
+        static void SubmitShader(ShaderFuture future, const ShaderDefines& defines, PreprocessedShader& vertex, PreprocessedShader& fragment);
+        // Watcher thread
+        static void OnShaderFilesChanged(const std::vector<std::string>& paths);
+
+        template<typename T> static ResourcePool<T>& GetPool();
     };
-}
\ No newline at end of file
+}
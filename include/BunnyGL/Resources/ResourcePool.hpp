@@ -0,0 +1,426 @@
+#pragma once
+#include <BunnyGL/Resources/ResourceHandle.hpp>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace BunnyGL {
+
+    enum class ResourceState : uint8_t {
+        Invalid,    // Stale or null handle
+        Loading,    // Reserved; the resource arrives later (Fill)
+        Ready,
+        Failed,     // Loading gave up; the handle stays valid but resolves to nullptr
+        Evicted     // Unloaded to meet the memory budget; reloads on the next use
+    };
+
+    struct ResidencyStats {
+        uint64_t ResidentBytes = 0;
+        uint64_t BudgetBytes = 0;       // 0 = unlimited
+        size_t Resident = 0;
+        size_t Evicted = 0;             // Currently evicted
+        uint64_t Evictions = 0;         // Totals
+        uint64_t Reloads = 0;
+    };
+
+    // Dense slot array of resources addressed by ResourceHandle, with optional
+    // names. Lookups (Get, Find) take a shared lock, so any number of threads
+    // can resolve handles at once; only Add and Remove are exclusive. A slot
+    // can be reserved before its resource exists, so asynchronous loads hand
+    // out their handle immediately.
+    //
+    // The pool also tracks residency: each resource's size, and the frame it
+    // was last resolved with Get. A slot reserved with a reload function can
+    // be evicted (resource destroyed, handle kept) and is brought back by
+    // RequestReload; the eviction policy itself is the owner's.
+    //
+    // Lifetime is explicit: the pool owns each resource until Remove hands it
+    // back. A pointer from Get stays valid until then, so callers remove
+    // resources only where nobody else can be using them (GL resources: on the
+    // GL thread, between frames).
+    template<typename T>
+    class ResourcePool {
+    public:
+        using Handle = ResourceHandle<T>;
+
+    private:
+        // Copyable so slots can move when the array grows (under the exclusive lock)
+        struct FrameStamp {
+            std::atomic<uint64_t> Frame{0};
+
+            FrameStamp() = default;
+            FrameStamp(const FrameStamp& other) : Frame(other.Frame.load(std::memory_order_relaxed)) {}
+            FrameStamp& operator=(const FrameStamp& other) {
+                Frame.store(other.Frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                return *this;
+            }
+        };
+
+        struct Slot {
+            std::unique_ptr<T> Resource;
+            ResourceState State = ResourceState::Invalid;  // Invalid = free slot
+            uint32_t Generation = 1;
+            std::vector<std::string> Names;
+            uint64_t SizeBytes = 0;
+            mutable FrameStamp LastUsed;                    // Written by Get under the shared lock
+            std::function<void(Handle)> Reload;             // Empty: not evictable
+        };
+
+        mutable std::shared_mutex m_Mutex;
+        std::vector<Slot> m_Slots;
+        std::vector<uint32_t> m_FreeSlots;
+        std::unordered_map<std::string, Handle> m_Names;
+        size_t m_Count = 0;
+
+        // Residency; counters are guarded by the exclusive lock
+        std::atomic<uint64_t> m_Frame{0};
+        std::atomic<uint64_t> m_BudgetBytes{0};
+        uint64_t m_ResidentBytes = 0;
+        size_t m_EvictedCount = 0;
+        uint64_t m_Evictions = 0;
+        uint64_t m_Reloads = 0;
+
+    public:
+        ResourcePool() = default;
+        ResourcePool(const ResourcePool&) = delete;
+        ResourcePool& operator=(const ResourcePool&) = delete;
+
+        // Invalid handle if the name is taken or the pool is full
+        Handle Add(std::unique_ptr<T> resource, const std::string& name = {}, uint64_t sizeBytes = 0) {
+            if (!resource) {
+                return {};
+            }
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Handle handle = Insert(std::move(resource), ResourceState::Ready, name);
+            if (handle) {
+                m_Slots[handle.GetIndex()].SizeBytes = sizeBytes;
+                m_ResidentBytes += sizeBytes;
+            }
+            return handle;
+        }
+
+        // Slot in the Loading state, to be filled later. reload (optional) makes
+        // the resource evictable: it must start a load that ends in Fill or Fail.
+        Handle Reserve(const std::string& name = {}, std::function<void(Handle)> reload = {}) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Handle handle = Insert(nullptr, ResourceState::Loading, name);
+            if (handle) {
+                m_Slots[handle.GetIndex()].Reload = std::move(reload);
+            }
+            return handle;
+        }
+
+        // Completes a reserved slot. False if the handle went stale meanwhile;
+        // the resource is then destroyed after the lock is released.
+        bool Fill(Handle handle, std::unique_ptr<T> resource, uint64_t sizeBytes = 0) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Slot* slot = Resolve(handle);
+            if (!slot || slot->Resource || !resource) {
+                return false;
+            }
+            slot->Resource = std::move(resource);
+            slot->State = ResourceState::Ready;
+            slot->SizeBytes = sizeBytes;
+            slot->LastUsed.Frame.store(m_Frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_ResidentBytes += sizeBytes;
+            return true;
+        }
+
+        void Fail(Handle handle) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Slot* slot = Resolve(handle);
+            if (slot && !slot->Resource) {
+                slot->State = ResourceState::Failed;
+            }
+        }
+
+        ResourceState GetState(Handle handle) const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            const Slot* slot = Resolve(handle);
+            return slot ? slot->State : ResourceState::Invalid;
+        }
+
+    private:
+        // Caller holds the exclusive lock
+        Handle Insert(std::unique_ptr<T> resource, ResourceState state, const std::string& name) {
+            if (!name.empty() && m_Names.count(name)) {
+                return {};
+            }
+
+            uint32_t index;
+            if (!m_FreeSlots.empty()) {
+                index = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            } else {
+                if (m_Slots.size() > Handle::MaxIndex) {
+                    return {};
+                }
+                index = static_cast<uint32_t>(m_Slots.size());
+                m_Slots.emplace_back();
+            }
+
+            Slot& slot = m_Slots[index];
+            slot.Resource = std::move(resource);
+            slot.State = state;
+            slot.SizeBytes = 0;
+            slot.LastUsed.Frame.store(m_Frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            Handle handle(index, slot.Generation);
+            if (!name.empty()) {
+                slot.Names.push_back(name);
+                m_Names.emplace(name, handle);
+            }
+            m_Count++;
+            return handle;
+        }
+
+    public:
+
+        // Another name for a live resource
+        bool AddName(const std::string& name, Handle handle) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Slot* slot = Resolve(handle);
+            if (!slot || name.empty() || !m_Names.emplace(name, handle).second) {
+                return false;
+            }
+            slot->Names.push_back(name);
+            return true;
+        }
+
+        // nullptr for stale or invalid handles and until the resource is ready.
+        // Marks the resource as used this frame.
+        T* Get(Handle handle) const {
+            ResourceState state;
+            return Get(handle, state);
+        }
+
+        T* Get(Handle handle, ResourceState& state) const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            const Slot* slot = Resolve(handle);
+            if (!slot) {
+                state = ResourceState::Invalid;
+                return nullptr;
+            }
+            state = slot->State;
+            // Only write when the frame changed, so hot resources don't bounce the cache line
+            uint64_t frame = m_Frame.load(std::memory_order_relaxed);
+            if (slot->LastUsed.Frame.load(std::memory_order_relaxed) != frame) {
+                slot->LastUsed.Frame.store(frame, std::memory_order_relaxed);
+            }
+            return slot->Resource.get();
+        }
+
+        Handle Find(const std::string& name) const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            auto it = m_Names.find(name);
+            return it != m_Names.end() ? it->second : Handle();
+        }
+
+        bool IsAlive(Handle handle) const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            return Resolve(handle) != nullptr;
+        }
+
+        // Invalidates the handle and every name of the resource, and returns
+        // it so the caller decides where it is destroyed
+        std::unique_ptr<T> Remove(Handle handle) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Slot* slot = Resolve(handle);
+            if (!slot) {
+                return nullptr;
+            }
+            for (const std::string& name : slot->Names) {
+                m_Names.erase(name);
+            }
+            slot->Names.clear();
+
+            std::unique_ptr<T> resource = std::move(slot->Resource);
+            if (slot->State == ResourceState::Evicted) {
+                m_EvictedCount--;
+            }
+            m_ResidentBytes -= resource ? slot->SizeBytes : 0;
+            slot->State = ResourceState::Invalid;
+            slot->Reload = nullptr;
+            // Generation 0 would let a handle encode to the reserved zero value
+            slot->Generation = slot->Generation == Handle::MaxGeneration ? 1 : slot->Generation + 1;
+            m_FreeSlots.push_back(handle.GetIndex());
+            m_Count--;
+            return resource;
+        }
+
+        // Drops one name; the slot is removed (and its resource returned) with its last name
+        std::unique_ptr<T> RemoveName(const std::string& name) {
+            Handle handle;
+            {
+                std::unique_lock<std::shared_mutex> lock(m_Mutex);
+                auto it = m_Names.find(name);
+                if (it == m_Names.end()) {
+                    return nullptr;
+                }
+                handle = it->second;
+                m_Names.erase(it);
+
+                Slot& slot = m_Slots[handle.GetIndex()];
+                slot.Names.erase(std::find(slot.Names.begin(), slot.Names.end(), name));
+                if (!slot.Names.empty()) {
+                    return nullptr;
+                }
+            }
+            return Remove(handle);
+        }
+
+        // Returns every resource; handles issued so far become stale
+        std::vector<std::unique_ptr<T>> Clear() {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            std::vector<std::unique_ptr<T>> resources;
+            resources.reserve(m_Count);
+            m_FreeSlots.clear();
+            for (uint32_t index = 0; index < m_Slots.size(); index++) {
+                Slot& slot = m_Slots[index];
+                if (slot.Resource) {
+                    resources.push_back(std::move(slot.Resource));
+                }
+                slot.Reload = nullptr;
+                if (slot.State != ResourceState::Invalid) {
+                    slot.State = ResourceState::Invalid;
+                    slot.Generation = slot.Generation == Handle::MaxGeneration ? 1 : slot.Generation + 1;
+                }
+                slot.Names.clear();
+                m_FreeSlots.push_back(index);
+            }
+            m_Names.clear();
+            m_Count = 0;
+            m_ResidentBytes = 0;
+            m_EvictedCount = 0;
+            return resources;
+        }
+
+        // --- Residency ---
+
+        // Stamp for Get; the owner advances it once per frame
+        void SetFrame(uint64_t frame) { m_Frame.store(frame, std::memory_order_relaxed); }
+        uint64_t GetFrame() const { return m_Frame.load(std::memory_order_relaxed); }
+
+        void SetBudget(uint64_t bytes) { m_BudgetBytes.store(bytes, std::memory_order_relaxed); }
+        uint64_t GetBudget() const { return m_BudgetBytes.load(std::memory_order_relaxed); }
+
+        struct ResidentEntry {
+            Handle Resource;
+            uint64_t LastUsedFrame;
+            uint64_t SizeBytes;
+        };
+
+        // Ready resources that have a reload function, least recently used first
+        std::vector<ResidentEntry> GetEvictionCandidates() const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            std::vector<ResidentEntry> entries;
+            for (uint32_t index = 0; index < m_Slots.size(); index++) {
+                const Slot& slot = m_Slots[index];
+                if (slot.State == ResourceState::Ready && slot.Reload) {
+                    entries.push_back({ Handle(index, slot.Generation), slot.LastUsed.Frame.load(std::memory_order_relaxed), slot.SizeBytes });
+                }
+            }
+            std::sort(entries.begin(), entries.end(),
+                [](const ResidentEntry& a, const ResidentEntry& b) { return a.LastUsedFrame < b.LastUsedFrame; });
+            return entries;
+        }
+
+        // Takes the resource out but keeps the handle and names (state Evicted).
+        // Refused if it was used within minIdleFrames of frame: the candidate
+        // list is a snapshot, and Get may have handed it out since.
+        std::unique_ptr<T> Evict(Handle handle, uint64_t frame, uint64_t minIdleFrames) {
+            std::unique_lock<std::shared_mutex> lock(m_Mutex);
+            Slot* slot = Resolve(handle);
+            if (!slot || slot->State != ResourceState::Ready || !slot->Reload) {
+                return nullptr;
+            }
+            // Get stamps under the shared lock, so this read sees every use
+            if (slot->LastUsed.Frame.load(std::memory_order_relaxed) + minIdleFrames > frame) {
+                return nullptr;
+            }
+            slot->State = ResourceState::Evicted;
+            m_ResidentBytes -= slot->SizeBytes;
+            m_EvictedCount++;
+            m_Evictions++;
+            return std::move(slot->Resource);
+        }
+
+        // Starts reloading an evicted resource (state Loading). False if it wasn't evicted.
+        bool RequestReload(Handle handle) {
+            std::function<void(Handle)> reload;
+            {
+                std::unique_lock<std::shared_mutex> lock(m_Mutex);
+                Slot* slot = Resolve(handle);
+                if (!slot || slot->State != ResourceState::Evicted) {
+                    return false;
+                }
+                slot->State = ResourceState::Loading;
+                m_EvictedCount--;
+                m_Reloads++;
+                reload = slot->Reload;
+            }
+            reload(handle);
+            return true;
+        }
+
+        ResidencyStats GetResidencyStats() const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            ResidencyStats stats;
+            stats.ResidentBytes = m_ResidentBytes;
+            stats.BudgetBytes = GetBudget();
+            for (const Slot& slot : m_Slots) {
+                stats.Resident += slot.State == ResourceState::Ready ? 1 : 0;
+            }
+            stats.Evicted = m_EvictedCount;
+            stats.Evictions = m_Evictions;
+            stats.Reloads = m_Reloads;
+            return stats;
+        }
+
+        size_t GetCount() const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            return m_Count;
+        }
+
+        std::vector<std::string> GetNames() const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            std::vector<std::string> names;
+            names.reserve(m_Names.size());
+            for (const auto& pair : m_Names) {
+                names.push_back(pair.first);
+            }
+            return names;
+        }
+
+        // callback(Handle, T&) for every ready resource, under the shared lock
+        template<typename Callback>
+        void ForEach(Callback&& callback) const {
+            std::shared_lock<std::shared_mutex> lock(m_Mutex);
+            for (uint32_t index = 0; index < m_Slots.size(); index++) {
+                const Slot& slot = m_Slots[index];
+                if (slot.Resource) {
+                    callback(Handle(index, slot.Generation), *slot.Resource);
+                }
+            }
+        }
+
+    private:
+        const Slot* Resolve(Handle handle) const {
+            if (!handle.IsValid() || handle.GetIndex() >= m_Slots.size()) {
+                return nullptr;
+            }
+            const Slot& slot = m_Slots[handle.GetIndex()];
+            return slot.State != ResourceState::Invalid && slot.Generation == handle.GetGeneration() ? &slot : nullptr;
+        }
+
+        Slot* Resolve(Handle handle) {
+            return const_cast<Slot*>(static_cast<const ResourcePool*>(this)->Resolve(handle));
+        }
+    };
+
+}
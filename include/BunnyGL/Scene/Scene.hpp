@@ -1,4 +1,5 @@
 #pragma once
+#include <BunnyGL/Renderer/CommandList.hpp>
 #include <memory>
 
 namespace BunnyGL {
@@ -11,9 +12,17 @@ namespace BunnyGL {
         virtual void OnAttach() = 0;
         virtual void OnDetach() = 0;
         
-        // Core methods
+        // Core methods. Parallel work can go through Application::Get().GetJobSystem().
         virtual void OnUpdate(float deltaTime) = 0;
-        virtual void OnRender() = 0;
+
+        // Records the frame's draws into commands; no direct GL calls here, the
+        // list may be replayed on the render thread. alpha in [0, 1): how far the
+        // current frame lies between the last two fixed simulation steps.
+        // Always 1 in variable-step mode.
+        virtual void OnRender(CommandList& commands, float alpha) = 0;
+
+        // Fixed-step simulation (see Application::SetFixedTimestep)
+        virtual void OnFixedUpdate(double fixedDeltaTime) { OnUpdate(static_cast<float>(fixedDeltaTime)); }
         
         // Optional overrides
         virtual void OnWindowResize(int width, int height) {}
@@ -0,0 +1,34 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BunnyGL {
+
+    class Scene;
+
+    // Named scene factories, so tools like BunnyGL_bench can iterate every
+    // scene without knowing the concrete types. Built-in scenes are registered
+    // on first use; applications can add their own with Register().
+    class SceneRegistry {
+    public:
+        using Factory = std::function<std::unique_ptr<Scene>()>;
+
+        // Replaces an existing entry with the same name
+        static void Register(const std::string& name, Factory factory);
+
+        // Registration order
+        static std::vector<std::string> GetNames();
+        static bool Has(const std::string& name);
+
+        // nullptr if no scene was registered under that name
+        static std::unique_ptr<Scene> Create(const std::string& name);
+
+        // Prevent instantiation
+        SceneRegistry() = delete;
+        SceneRegistry(const SceneRegistry&) = delete;
+        SceneRegistry& operator=(const SceneRegistry&) = delete;
+    };
+
+}
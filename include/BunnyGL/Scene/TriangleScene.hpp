@@ -1,6 +1,8 @@
 #pragma once
 #include <BunnyGL/Scene/Scene.hpp>
 #include <BunnyGL/Renderer/Shader.hpp>
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
 #include <BunnyGL/Resources/ResourceManager.hpp>
 #include <memory>
 #include <vector>
@@ -11,11 +13,13 @@ namespace BunnyGL {
 
     class TriangleScene : public Scene {
     private:
-        unsigned int m_VAO = 0;
-        unsigned int m_VBO = 0;
-        std::shared_ptr<Shader> m_Shader;
+        ShaderHandle m_Shader;
+        MeshHandle m_Mesh;
+        PipelineState m_Pipeline;
+        UniformHandle m_TransformUniform;
         std::vector<float> m_Vertices;
         float m_RotationAngle = 0.0f;
+        float m_PreviousRotationAngle = 0.0f;
         
     public:
         TriangleScene();
@@ -24,7 +28,7 @@ namespace BunnyGL {
         void OnAttach() override;
         void OnDetach() override;
         void OnUpdate(float deltaTime) override;
-        void OnRender() override;
+        void OnRender(CommandList& commands, float alpha) override;
         
     private:
         void SetupTriangle();
@@ -1,10 +1,10 @@
 #version 330 core
 
+#include "include/Transform.glsl"
+
 layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec4 a_Color;
 
-uniform mat4 u_Transform;
-
 out vec4 v_Color;
 
 void main() {
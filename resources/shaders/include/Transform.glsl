@@ -0,0 +1,11 @@
+#pragma once
+
+// Object transform: per-draw uniform block when the variant defines
+// BG_OBJECT_BLOCK, a plain uniform otherwise
+#ifdef BG_OBJECT_BLOCK
+layout(std140) uniform Object {
+    mat4 u_Transform;
+};
+#else
+uniform mat4 u_Transform;
+#endif
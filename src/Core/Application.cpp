@@ -1,21 +1,48 @@
 #include <BunnyGL/Core/Application.hpp>
 #include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+#include <BunnyGL/Renderer/GpuProfiler.hpp>
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Renderer/RenderThread.hpp>
+#include <BunnyGL/Renderer/ShaderCache.hpp>
+#include <BunnyGL/Renderer/ShaderCompiler.hpp>
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <BunnyGL/Resources/AssetLoader.hpp>
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Resources/ResourceManager.hpp>
+#include <BunnyGL/Renderer/UniformArena.hpp>
 #include <BunnyGL/Scene/Scene.hpp>
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace BunnyGL {
 
-    Application::Application() {
-        BG_INFO("Application Starting ...");
+    namespace {
+        // Monotonic seconds; unlike glfwGetTime this also works without GLFW (headless)
+        double GetTime() {
+            static const auto s_Start = std::chrono::steady_clock::now();
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_Start).count();
+        }
+    }
 
-        // Create window
-        m_Window = new Window();
+    Application::Application(const ApplicationSpecification& spec)
+        : m_MaxFrames(spec.MaxFrames), m_AssetUploadBudgetMs(spec.AssetUploadBudgetMs), m_AssetUploadBudgetBytes(spec.AssetUploadBudgetBytes) {
+        BG_INFO("Application Starting ...");
+        Profiler::SetThreadName("Main");
 
-        // Initialize OpenGL loader (GLAD)
-        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-            BG_FATAL("Failed to initialize GLAD");
+        if (s_Instance) {
+            BG_FATAL("Only one Application can exist at a time");
         }
+        s_Instance = this;
+
+        m_JobSystem = std::make_unique<JobSystem>(spec.WorkerThreads);
+
+        // Create window (or offscreen context) and load OpenGL
+        m_Window = new Window(spec.Window);
 
         // Log OpenGL info
         BG_INFO("OpenGL Info:");
@@ -23,73 +50,276 @@ namespace BunnyGL {
         BG_INFO("  Renderer: ", glGetString(GL_RENDERER));
         BG_INFO("  Version: ", glGetString(GL_VERSION));
 
-        m_LastFrameTime = static_cast<float>(glfwGetTime());
+        GpuProfiler::Init();
+        UniformArena::Init();
+        ShaderCache::Init(spec.ShaderCacheDirectory, spec.ShaderCacheMaxBytes);
+        FileSystem::SetUseEmbedded(spec.UseEmbeddedResources && !spec.ShaderHotReload);
+        if (!spec.ResourceArchive.empty() && !spec.ShaderHotReload) {
+            // A missing archive just means loose files
+            FileSystem::MountArchive(spec.ResourceArchive);
+        }
+        ShaderCompiler::Init(*m_Window);
+        ResourceManager::SetShaderHotReload(spec.ShaderHotReload);
+        AssetLoader::Init(spec.AssetLoaderThreads);
+        ResourceManager::SetMemoryBudget<Texture2D>(spec.TextureMemoryBudget);
+        ResourceManager::SetMemoryBudget<Mesh>(spec.MeshMemoryBudget);
+
+        if (spec.UseRenderThread) {
+            m_RenderThread = std::make_unique<RenderThread>(*m_Window, [this](const CommandList& commands, uint32_t frame) {
+                RenderFrame(commands, frame);
+            });
+        }
+
+        m_LastFrameTime = GetTime();
     }
 
     Application::~Application() {
+        // Scenes own GL objects, so they have to go while the context still exists
+        SetScene(nullptr);
+        ResourceManager::SetShaderHotReload(false);
+        AssetLoader::Shutdown();
+        // Hands the context back to this thread
+        m_RenderThread.reset();
+        ResourceManager::ClearAll();
+        FileSystem::UnmountArchives();
+        UniformArena::Shutdown();
+        ShaderCache::Shutdown();
+        GpuProfiler::Shutdown();
         delete m_Window;
+        m_JobSystem.reset();
+        s_Instance = nullptr;
         BG_INFO("Application Shutdown ...");
     }
 
     void Application::SetScene(std::unique_ptr<Scene> scene) {
-        if (m_CurrentScene) {
-            m_CurrentScene->OnDetach();
-        }
-        m_CurrentScene = std::move(scene);
-        if (m_CurrentScene) {
-            m_CurrentScene->OnAttach();
+        // Attach/detach create and delete GL objects, so they run on the context
+        // thread, after the last frame that may still reference the old scene
+        ExecuteOnRenderThread([&]() {
+            if (m_CurrentScene) {
+                m_CurrentScene->OnDetach();
+                m_CurrentScene.reset();
+            }
+            m_CurrentScene = std::move(scene);
+            if (m_CurrentScene) {
+                m_CurrentScene->OnAttach();
+            }
+        });
+    }
+
+    void Application::ExecuteOnRenderThread(const std::function<void()>& task) {
+        // Tasks talk to GL directly, so the state cache can't trust its copy afterwards
+        auto run = [&]() {
+            task();
+            RenderStateCache::Invalidate();
+        };
+        if (m_RenderThread) {
+            m_RenderThread->Execute(run);
+        } else {
+            run();
         }
     }
 
     void Application::SetTargetFPS(float fps) {
-        // For simplicity, we'll just store it
-        // Actual limiting would be done in the loop
+        m_TargetFPS = fps;
+        ApplyFramePacing();
+    }
+
+    void Application::SetVSync(bool enabled) {
+        m_VSync = enabled;
+        ApplyFramePacing();
+    }
+
+    void Application::ApplyFramePacing() {
+        if (m_VSync) {
+            // Hit lower targets by skipping vertical blanks (30 FPS on 60 Hz = interval 2)
+            int refreshRate = m_Window->GetRefreshRate();
+            int interval = 1;
+            if (m_TargetFPS > 0.0f && refreshRate > 0) {
+                interval = std::max(1, static_cast<int>(std::lround(refreshRate / m_TargetFPS)));
+            }
+            ExecuteOnRenderThread([&]() { m_Window->SetSwapInterval(interval); });
+            m_FramePacer.SetMode(FramePacingMode::VSync);
+            m_FramePacer.SetTargetFPS(refreshRate > 0 ? static_cast<double>(refreshRate) / interval : m_TargetFPS);
+            BG_INFO("Frame pacing: VSync, swap interval ", interval, " (", refreshRate, " Hz)");
+        } else {
+            ExecuteOnRenderThread([&]() { m_Window->SetSwapInterval(0); });
+            m_FramePacer.SetMode(m_TargetFPS > 0.0f ? FramePacingMode::Hybrid : FramePacingMode::Unlimited);
+            m_FramePacer.SetTargetFPS(m_TargetFPS);
+            if (m_TargetFPS > 0.0f) {
+                BG_INFO("Frame pacing: target ", m_TargetFPS, " FPS");
+            } else {
+                BG_INFO("Frame pacing: uncapped");
+            }
+        }
     }
 
 
     void Application::Run() {
         BG_INFO("Entering Main Loop ...");
+        BG_PROFILE_SCOPE("Application::Run");
         
         while (m_Running && !m_Window->ShouldClose()) {
             // Update timing
             UpdateTime();
-            CalculateFPS();
-            
-            // Clear screen
-            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-            
-            // Update and render scene
-            if (m_CurrentScene) {
-                m_CurrentScene->OnUpdate(m_DeltaTime);
-                m_CurrentScene->OnRender();
+
+            RunFrame();
+
+            // Sleep/spin until the next frame deadline
+            {
+                BG_PROFILE_SCOPE("FramePacer::Wait");
+                m_FramePacer.Wait();
             }
-            
-            // Swap buffers
-            m_Window->SwapBuffers();
-            m_Window->PollEvents();
-            
-            m_FrameCount++;
+        }
+    }
+
+    void Application::Step(double deltaTime) {
+        m_FrameTime = deltaTime;
+        m_DeltaTime = static_cast<float>(deltaTime);
+        m_TotalTime += deltaTime;
+
+        RunFrame();
+    }
+
+    void Application::RunFrame() {
+        using Clock = std::chrono::steady_clock;
+        auto toMs = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+        Profiler::BeginFrame();
+        BG_PROFILE_SCOPE("Frame");
+
+        Clock::time_point frameStart = Clock::now();
+        CalculateFPS();
+        // Resources resolved from here on count as used this frame
+        ResourceManager::BeginFrame(m_FrameIndex);
+
+        if (m_CurrentScene) {
+            UpdateScene();
+        }
+        Clock::time_point updateEnd = Clock::now();
+
+        // Record the frame
+        CommandList& commands = m_RenderThread ? m_RenderThread->GetRecordList() : m_CommandList;
+        commands.Reset();
+        commands.Clear(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+
+        FrameUniforms frame;
+        frame.Time = static_cast<float>(m_TotalTime);
+        frame.DeltaTime = m_DeltaTime;
+        frame.Resolution = glm::vec2(static_cast<float>(m_Window->GetWidth()), static_cast<float>(m_Window->GetHeight()));
+        frame.FrameIndex = static_cast<uint32_t>(m_FrameIndex);
+        commands.BindUniformBlock(UniformBinding::Frame, commands.AllocateUniforms(frame));
+
+        if (m_CurrentScene) {
+            BG_PROFILE_SCOPE("Scene::OnRender");
+            m_CurrentScene->OnRender(commands, m_InterpolationAlpha);
+        }
+
+        Clock::time_point renderEnd = Clock::now();
+
+        // Replay and present
+        if (m_RenderThread) {
+            // Only waits for the previous frame, so the next update overlaps this replay
+            m_RenderThread->SubmitFrame(Profiler::GetFrame());
+        } else {
+            RenderFrame(commands, Profiler::GetFrame());
+        }
+        m_Window->PollEvents();
+
+        Clock::time_point frameEnd = Clock::now();
+        m_FrameTimings.Frame = Profiler::GetFrame();
+        m_FrameTimings.UpdateMs = toMs(updateEnd - frameStart);
+        m_FrameTimings.RenderMs = toMs(renderEnd - updateEnd);
+        m_FrameTimings.SwapMs = toMs(frameEnd - renderEnd);
+        m_FrameTimings.TotalMs = toMs(frameEnd - frameStart);
+        
+        m_FrameCount++;
+        m_FrameIndex++;
+
+        if (m_MaxFrames > 0 && m_FrameIndex >= m_MaxFrames) {
+            Close();
         }
     }
     
+    void Application::RenderFrame(const CommandList& commands, uint32_t frame) {
+        // On the render thread the main thread has moved on to the next frame
+        ProfileFrameScope profileFrame(frame);
+        GpuProfiler::BeginFrame(frame);
+        RenderStateCache::BeginFrame();
+        BG_GPU_PROFILE_SCOPE("GPU Frame");
+        {
+            BG_PROFILE_SCOPE("CommandList::Execute");
+            BG_GPU_PROFILE_SCOPE("CommandList::Execute");
+            commands.Execute();
+        }
+        {
+            BG_PROFILE_SCOPE("Window::SwapBuffers");
+            BG_GPU_PROFILE_SCOPE("SwapBuffers");
+            m_Window->SwapBuffers();
+        }
+        // Streamed assets and shaders from ResourceManager::LoadShaders become ready for the next frame
+        AssetLoader::ProcessUploads(m_AssetUploadBudgetMs, static_cast<size_t>(m_AssetUploadBudgetBytes));
+        ResourceManager::PollShaders();
+        ResourceManager::EnforceMemoryBudgets();
+    }
+
+    void Application::SetFixedTimestep(double tickRate, int maxCatchUpSteps) {
+        m_FixedTimestep = tickRate > 0.0 ? 1.0 / tickRate : 0.0;
+        m_MaxCatchUpSteps = std::max(1, maxCatchUpSteps);
+        m_Accumulator = 0.0;
+        m_InterpolationAlpha = 1.0f;
+
+        if (m_FixedTimestep > 0.0) {
+            BG_INFO("Fixed timestep: ", tickRate, " Hz, max ", m_MaxCatchUpSteps, " steps per frame");
+        } else {
+            BG_INFO("Variable timestep");
+        }
+    }
+
     void Application::UpdateTime() {
-        float currentTime = static_cast<float>(glfwGetTime());
-        m_DeltaTime = currentTime - m_LastFrameTime;
+        double currentTime = GetTime();
+        m_FrameTime = currentTime - m_LastFrameTime;
+        m_DeltaTime = static_cast<float>(m_FrameTime);
         m_LastFrameTime = currentTime;
         m_TotalTime = currentTime;
     }
+
+    void Application::UpdateScene() {
+        BG_PROFILE_SCOPE("Scene::OnUpdate");
+
+        if (m_FixedTimestep <= 0.0) {
+            m_CurrentScene->OnUpdate(m_DeltaTime);
+            m_InterpolationAlpha = 1.0f;
+            return;
+        }
+
+        m_Accumulator += m_FrameTime;
+
+        int steps = 0;
+        while (m_Accumulator >= m_FixedTimestep && steps < m_MaxCatchUpSteps) {
+            m_CurrentScene->OnFixedUpdate(m_FixedTimestep);
+            m_Accumulator -= m_FixedTimestep;
+            steps++;
+        }
+
+        // Too far behind (breakpoint, hitch, slow machine): drop the backlog
+        // instead of spiralling, keeping only the fractional step
+        if (m_Accumulator >= m_FixedTimestep) {
+            m_Accumulator = std::fmod(m_Accumulator, m_FixedTimestep);
+        }
+
+        m_InterpolationAlpha = static_cast<float>(m_Accumulator / m_FixedTimestep);
+    }
     
     void Application::CalculateFPS() {
-        if (m_TotalTime - m_LastFPSCalcTime > 1.0f) { // Every second
-            m_FPS = static_cast<float>(m_FrameCount) / (m_TotalTime - m_LastFPSCalcTime);
+        if (m_TotalTime - m_LastFPSCalcTime > 1.0) { // Every second
+            m_FPS = static_cast<float>(m_FrameCount / (m_TotalTime - m_LastFPSCalcTime));
             m_LastFPSCalcTime = m_TotalTime;
             m_FrameCount = 0;
             
             // Log FPS every 5 seconds
-            static float lastLogTime = 0.0f;
-            if (m_TotalTime - lastLogTime > 5.0f) {
-                BG_RAW("FPS:", m_FPS, "Delta: ",m_DeltaTime * 1000.0f,"ms");
+            static double lastLogTime = 0.0;
+            if (m_TotalTime - lastLogTime > 5.0) {
+                BG_LOG(Debug, Core, "FPS: ", m_FPS, " Delta: ", m_DeltaTime * 1000.0f, "ms");
                 lastLogTime = m_TotalTime;
             }
         }
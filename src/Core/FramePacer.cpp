@@ -0,0 +1,124 @@
+#include <BunnyGL/Core/FramePacer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #include <immintrin.h>
+    #define BG_CPU_RELAX() _mm_pause()
+#else
+    #define BG_CPU_RELAX() std::this_thread::yield()
+#endif
+
+namespace BunnyGL {
+
+    namespace {
+        constexpr double MinSpinMargin = 0.0002;
+        constexpr double MaxSpinMargin = 0.004;
+    }
+
+    void FramePacer::SetTargetFPS(double fps) {
+        m_TargetPeriod = fps > 0.0 ? 1.0 / fps : 0.0;
+        m_Started = false;
+        ResetStats();
+    }
+
+    void FramePacer::SetMode(FramePacingMode mode) {
+        m_Mode = mode;
+        m_Started = false;
+        ResetStats();
+    }
+
+    void FramePacer::ResetStats() {
+        m_Stats = FramePacingStats();
+        m_Stats.SpinMarginMs = m_SpinMargin * 1000.0;
+        m_ErrorMean = 0.0;
+        m_ErrorM2 = 0.0;
+    }
+
+    void FramePacer::Wait() {
+        Clock::time_point now = Clock::now();
+
+        if (!m_Started) {
+            m_Started = true;
+            m_LastFrame = now;
+            m_Deadline = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_TargetPeriod));
+            return;
+        }
+
+        if (m_Mode == FramePacingMode::Hybrid && m_TargetPeriod > 0.0) {
+            if (now < m_Deadline) {
+                SleepUntil(m_Deadline);
+                now = Clock::now();
+            }
+
+            // Chain deadlines so small errors don't accumulate, but never try to
+            // catch up on a frame we already missed by a whole period
+            auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_TargetPeriod));
+            m_Deadline += period;
+            if (m_Deadline < now) {
+                m_Deadline = now + period;
+            }
+        }
+
+        RecordFrame(now);
+    }
+
+    void FramePacer::SleepUntil(Clock::time_point deadline) {
+        // Coarse sleep in steps, learning how much the OS oversleeps
+        for (;;) {
+            double remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+            if (remaining <= m_SpinMargin) {
+                break;
+            }
+
+            double request = std::min(remaining - m_SpinMargin, 0.002);
+            Clock::time_point before = Clock::now();
+            std::this_thread::sleep_for(std::chrono::duration<double>(request));
+            double overshoot = std::chrono::duration<double>(Clock::now() - before).count() - request;
+
+            // Grow quickly on a bad sleep, shrink slowly after good ones
+            if (overshoot > m_SpinMargin) {
+                m_SpinMargin = std::min(overshoot * 1.25, MaxSpinMargin);
+            } else {
+                m_SpinMargin = std::max(m_SpinMargin * 0.99 + overshoot * 0.01, MinSpinMargin);
+            }
+        }
+
+        // Spin the remaining sub-millisecond
+        while (Clock::now() < deadline) {
+            BG_CPU_RELAX();
+        }
+    }
+
+    void FramePacer::RecordFrame(Clock::time_point now) {
+        double period = std::chrono::duration<double>(now - m_LastFrame).count();
+        m_LastFrame = now;
+
+        if (m_TargetPeriod <= 0.0) {
+            return;
+        }
+
+        double error = period - m_TargetPeriod;
+        m_Stats.Frames++;
+        if (error > LateThreshold) {
+            m_Stats.LateFrames++;
+        }
+
+        double delta = error - m_ErrorMean;
+        m_ErrorMean += delta / static_cast<double>(m_Stats.Frames);
+        m_ErrorM2 += delta * (error - m_ErrorMean);
+
+        m_Stats.MeanErrorMs = m_ErrorMean * 1000.0;
+        m_Stats.StdDevErrorMs = m_Stats.Frames > 1 ? std::sqrt(m_ErrorM2 / static_cast<double>(m_Stats.Frames - 1)) * 1000.0 : 0.0;
+        if (m_Stats.Frames == 1) {
+            m_Stats.MaxErrorMs = m_Stats.MinErrorMs = error * 1000.0;
+        } else {
+            m_Stats.MaxErrorMs = std::max(m_Stats.MaxErrorMs, error * 1000.0);
+            m_Stats.MinErrorMs = std::min(m_Stats.MinErrorMs, error * 1000.0);
+        }
+        m_Stats.SpinMarginMs = m_SpinMargin * 1000.0;
+    }
+
+}
@@ -0,0 +1,266 @@
+#include <BunnyGL/Core/JobSystem.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <string>
+
+namespace BunnyGL {
+
+    struct Job {
+        JobFunction Function;
+        JobCounter* Counter;
+    };
+
+    namespace {
+        // Which pool the calling thread belongs to, and its slot there
+        thread_local const JobSystem* t_System = nullptr;
+        thread_local int t_ThreadIndex = -1;
+
+        // Idle workers spin this many rounds before going to sleep
+        constexpr int SpinRounds = 64;
+    }
+
+    // --- WorkStealingDeque ---
+
+    WorkStealingDeque::WorkStealingDeque(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        m_Buffer = std::make_unique<std::atomic<Job*>[]>(size);
+        m_Mask = static_cast<int64_t>(size - 1);
+    }
+
+    bool WorkStealingDeque::Push(Job* job) {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top > m_Mask) {
+            return false;
+        }
+        m_Buffer[bottom & m_Mask].store(job, std::memory_order_relaxed);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    Job* WorkStealingDeque::Pop() {
+        // Sequentially consistent store/load instead of a standalone fence: the
+        // claim on the bottom slot must be visible before we look at m_Top
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+
+        if (top > bottom) {
+            // Empty
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* job = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last job: race against thieves for it
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* WorkStealingDeque::Steal() {
+        int64_t top = m_Top.load(std::memory_order_seq_cst);
+        int64_t bottom = m_Bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        Job* job = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr; // Lost to the owner or another thief
+        }
+        return job;
+    }
+
+    // --- JobSystem ---
+
+    JobSystem::JobSystem(uint32_t workerThreads) {
+        if (workerThreads == 0) {
+            uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerThreads = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        // Every deque exists before any thread can try to steal from it
+        for (uint32_t i = 0; i < workerThreads + 1; ++i) {
+            m_Workers.push_back(std::make_unique<Worker>());
+        }
+
+        t_System = this;
+        t_ThreadIndex = 0;
+
+        for (uint32_t i = 1; i < m_Workers.size(); ++i) {
+            m_Workers[i]->Thread = std::thread([this, i]() { WorkerLoop(i); });
+        }
+
+        BG_INFO("Job system started with ", workerThreads, " worker threads");
+    }
+
+    JobSystem::~JobSystem() {
+        // Finish whatever is still queued, then let the workers go
+        while (Job* job = FindJob(GetThreadIndex())) {
+            Execute(job);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+            m_Stopping.store(true);
+        }
+        m_WakeCV.notify_all();
+
+        for (size_t i = 1; i < m_Workers.size(); ++i) {
+            m_Workers[i]->Thread.join();
+        }
+
+        if (t_System == this) {
+            t_System = nullptr;
+            t_ThreadIndex = -1;
+        }
+    }
+
+    int JobSystem::GetThreadIndex() const {
+        return t_System == this ? t_ThreadIndex : -1;
+    }
+
+    void JobSystem::Run(JobFunction function, JobCounter* counter, JobCounter* dependency) {
+        Job* job = new Job{ std::move(function), counter };
+        if (counter) {
+            counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (dependency) {
+            std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+            if (dependency->m_Pending.load(std::memory_order_acquire) != 0) {
+                // Scheduled by whichever job finishes the dependency
+                dependency->m_Continuations.push_back(job);
+                return;
+            }
+        }
+
+        Schedule(job);
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        int threadIndex = GetThreadIndex();
+        while (!counter.IsDone()) {
+            if (Job* job = FindJob(threadIndex)) {
+                Execute(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::Schedule(Job* job) {
+        m_Queued.fetch_add(1, std::memory_order_seq_cst);
+
+        int threadIndex = GetThreadIndex();
+        if (threadIndex < 0 || !m_Workers[threadIndex]->Queue.Push(job)) {
+            // Outside the pool, or the local deque is full
+            std::lock_guard<std::mutex> lock(m_SharedMutex);
+            m_SharedQueue.push_back(job);
+        }
+
+        if (m_Sleeping.load(std::memory_order_seq_cst) > 0) {
+            // Taking the mutex orders this with a worker about to wait
+            { std::lock_guard<std::mutex> lock(m_WakeMutex); }
+            m_WakeCV.notify_one();
+        }
+    }
+
+    Job* JobSystem::FindJob(int threadIndex) {
+        Job* job = nullptr;
+
+        if (threadIndex >= 0) {
+            job = m_Workers[threadIndex]->Queue.Pop();
+        }
+
+        if (!job) {
+            std::lock_guard<std::mutex> lock(m_SharedMutex);
+            if (!m_SharedQueue.empty()) {
+                job = m_SharedQueue.front();
+                m_SharedQueue.pop_front();
+            }
+        }
+
+        if (!job) {
+            // Steal, starting after our own slot so thieves spread out
+            size_t count = m_Workers.size();
+            size_t start = threadIndex >= 0 ? static_cast<size_t>(threadIndex) + 1 : 0;
+            for (size_t i = 0; i < count && !job; ++i) {
+                size_t victim = (start + i) % count;
+                if (static_cast<int>(victim) != threadIndex) {
+                    job = m_Workers[victim]->Queue.Steal();
+                }
+            }
+        }
+
+        if (job) {
+            m_Queued.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    void JobSystem::Execute(Job* job) {
+        job->Function();
+
+        JobCounter* counter = job->Counter;
+        delete job;
+
+        if (!counter) {
+            return;
+        }
+
+        // m_Completing keeps IsDone() false until this is the last access to the counter
+        counter->m_Completing.fetch_add(1, std::memory_order_acq_rel);
+        if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::vector<Job*> ready;
+            {
+                std::lock_guard<std::mutex> lock(counter->m_Mutex);
+                ready.swap(counter->m_Continuations);
+            }
+            for (Job* continuation : ready) {
+                Schedule(continuation);
+            }
+        }
+        counter->m_Completing.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void JobSystem::WorkerLoop(uint32_t index) {
+        t_System = this;
+        t_ThreadIndex = static_cast<int>(index);
+        Profiler::SetThreadName("Worker " + std::to_string(index));
+
+        int idleRounds = 0;
+        for (;;) {
+            if (Job* job = FindJob(static_cast<int>(index))) {
+                Execute(job);
+                idleRounds = 0;
+                continue;
+            }
+
+            if (m_Stopping.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            if (++idleRounds < SpinRounds) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_WakeMutex);
+            m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+            m_WakeCV.wait(lock, [this]() {
+                return m_Queued.load(std::memory_order_seq_cst) > 0 || m_Stopping.load(std::memory_order_relaxed);
+            });
+            m_Sleeping.fetch_sub(1, std::memory_order_relaxed);
+            idleRounds = 0;
+        }
+    }
+
+}
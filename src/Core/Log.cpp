@@ -0,0 +1,301 @@
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/LogFormatter.hpp>
+#include <BunnyGL/Core/LogBinarySink.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace BunnyGL {
+
+    namespace {
+
+        // A producer ring plus a flag set when its owning thread exits
+        struct ThreadRing {
+            LogRingBuffer Buffer;
+            std::atomic<bool> Retired{false};
+
+            explicit ThreadRing(size_t capacity) : Buffer(capacity) {}
+        };
+
+        enum class BackendState { NotStarted, Running, ShutDown };
+        std::atomic<BackendState> s_State{BackendState::NotStarted};
+
+        class LogBackend {
+        private:
+            // Producer side
+            std::mutex m_RegistryMutex;
+            std::vector<std::unique_ptr<ThreadRing>> m_Rings;
+            std::atomic<size_t> m_RingCapacity{1024};
+            std::atomic<LogOverflowPolicy> m_Overflow{LogOverflowPolicy::Drop};
+            std::atomic<uint64_t> m_Dropped{0};
+
+            // Backend thread
+            std::thread m_Thread;
+            std::mutex m_WakeMutex;
+            std::condition_variable m_WakeCV;
+            std::condition_variable m_FlushedCV;
+            bool m_WakeRequested = false;
+            bool m_Stopping = false;
+            uint64_t m_PassesStarted = 0;      // Drain passes; a pass empties every ring
+            uint64_t m_PassesCompleted = 0;
+            uint64_t m_ReportedDropped = 0;
+            std::vector<LogRecord> m_Batch;
+            std::vector<ThreadRing*> m_Snapshot;
+
+            // Sinks
+            std::mutex m_SinkMutex;
+            bool m_Console = true;
+            std::ofstream m_File;
+            LogFormatter m_Formatter;
+            LogBinarySink m_BinarySink;
+
+        public:
+            static LogBackend& Get() {
+                static LogBackend s_Instance;
+                return s_Instance;
+            }
+
+            LogBackend() {
+                m_Thread = std::thread([this]() { ThreadLoop(); });
+                s_State.store(BackendState::Running, std::memory_order_release);
+            }
+
+            ~LogBackend() {
+                {
+                    std::lock_guard<std::mutex> lock(m_WakeMutex);
+                    m_Stopping = true;
+                }
+                m_WakeCV.notify_one();
+                m_Thread.join();
+                s_State.store(BackendState::ShutDown, std::memory_order_release);
+            }
+
+            ThreadRing* RegisterThread() {
+                auto ring = std::make_unique<ThreadRing>(m_RingCapacity.load(std::memory_order_relaxed));
+                ThreadRing* result = ring.get();
+                std::lock_guard<std::mutex> lock(m_RegistryMutex);
+                m_Rings.push_back(std::move(ring));
+                return result;
+            }
+
+            LogOverflowPolicy GetOverflowPolicy() const { return m_Overflow.load(std::memory_order_relaxed); }
+            void OnDropped() { m_Dropped.fetch_add(1, std::memory_order_relaxed); }
+            uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+            void Wake() {
+                {
+                    std::lock_guard<std::mutex> lock(m_WakeMutex);
+                    m_WakeRequested = true;
+                }
+                m_WakeCV.notify_one();
+            }
+
+            // Waits for a drain pass that started after this call: it empties
+            // every ring, so it writes everything committed before the call
+            void Flush() {
+                std::unique_lock<std::mutex> lock(m_WakeMutex);
+                uint64_t pass = m_PassesStarted + 1;
+                m_WakeRequested = true;
+                m_WakeCV.notify_one();
+                m_FlushedCV.wait(lock, [&]() { return m_PassesCompleted >= pass || m_Stopping; });
+            }
+
+            void Configure(const LogConfig& config) {
+                Flush();
+                m_RingCapacity.store(config.RingCapacity > 0 ? config.RingCapacity : 1, std::memory_order_relaxed);
+                m_Overflow.store(config.Overflow, std::memory_order_relaxed);
+
+                std::lock_guard<std::mutex> lock(m_SinkMutex);
+                m_Console = config.Console;
+                if (m_File.is_open()) {
+                    m_File.close();
+                }
+                if (!config.FilePath.empty()) {
+                    m_File.open(config.FilePath, std::ios::out | std::ios::app);
+                    if (!m_File.is_open()) {
+                        std::cerr << Colors::RED << "[LOG] Failed to open log file " << config.FilePath << Colors::RESET << '\n';
+                    }
+                }
+
+                m_BinarySink.Close();
+                if (!config.BinaryFilePath.empty() && !m_BinarySink.Open(config.BinaryFilePath, config.BinaryFileCapacity)) {
+                    std::cerr << Colors::RED << "[LOG] Failed to open binary log " << config.BinaryFilePath << Colors::RESET << '\n';
+                }
+            }
+
+        private:
+            void ThreadLoop() {
+                for (;;) {
+                    uint64_t pass;
+                    {
+                        std::lock_guard<std::mutex> lock(m_WakeMutex);
+                        pass = ++m_PassesStarted;
+                    }
+                    size_t written = Drain();
+
+                    std::unique_lock<std::mutex> lock(m_WakeMutex);
+                    m_PassesCompleted = pass;
+                    m_FlushedCV.notify_all();
+
+                    if (written > 0) {
+                        continue;
+                    }
+                    if (m_Stopping) {
+                        break;
+                    }
+                    // Producers never signal on the hot path; poll at a short interval instead
+                    m_WakeCV.wait_for(lock, std::chrono::milliseconds(2), [&]() { return m_WakeRequested || m_Stopping; });
+                    m_WakeRequested = false;
+                }
+            }
+
+            // Moves everything currently queued out of the rings and writes it, oldest first
+            size_t Drain() {
+                {
+                    std::lock_guard<std::mutex> lock(m_RegistryMutex);
+                    // Rings of exited threads can go once they are empty
+                    m_Rings.erase(std::remove_if(m_Rings.begin(), m_Rings.end(), [](const std::unique_ptr<ThreadRing>& ring) {
+                        return ring->Retired.load(std::memory_order_acquire) && ring->Buffer.IsEmpty();
+                    }), m_Rings.end());
+
+                    m_Snapshot.clear();
+                    for (const auto& ring : m_Rings) {
+                        m_Snapshot.push_back(ring.get());
+                    }
+                }
+
+                m_Batch.clear();
+                for (ThreadRing* ring : m_Snapshot) {
+                    while (const LogRecord* record = ring->Buffer.Peek()) {
+                        m_Batch.push_back(*record);
+                        ring->Buffer.Pop();
+                    }
+                }
+
+                uint64_t dropped = m_Dropped.load(std::memory_order_relaxed);
+                if (m_Batch.empty() && dropped == m_ReportedDropped) {
+                    return 0;
+                }
+
+                std::stable_sort(m_Batch.begin(), m_Batch.end(), [](const LogRecord& a, const LogRecord& b) {
+                    return a.Timestamp < b.Timestamp;
+                });
+
+                std::lock_guard<std::mutex> lock(m_SinkMutex);
+                std::ofstream* file = m_File.is_open() ? &m_File : nullptr;
+                if (m_Console || file) {
+                    for (const LogRecord& record : m_Batch) {
+                        std::ostream* console = nullptr;
+                        if (m_Console) {
+                            console = record.Level >= LogLevel::Error && record.Level != LogLevel::Raw ? &std::cerr : &std::cout;
+                        }
+                        m_Formatter.Write(record, console, file);
+                    }
+                }
+
+                // The binary sink only copies raw bytes, no formatting
+                if (m_BinarySink.IsOpen()) {
+                    for (const LogRecord& record : m_Batch) {
+                        m_BinarySink.Append(record);
+                    }
+                }
+
+                if (dropped != m_ReportedDropped) {
+                    if (m_BinarySink.IsOpen()) {
+                        m_BinarySink.AppendDropped(dropped - m_ReportedDropped);
+                    }
+                    if (m_Console) {
+                        std::cerr << Colors::YELLOW << "[LOG] Dropped " << (dropped - m_ReportedDropped)
+                                  << " messages (ring buffer full)" << Colors::RESET << '\n';
+                    }
+                    m_ReportedDropped = dropped;
+                }
+
+                std::cout.flush();
+                std::cerr.flush();
+                if (file) file->flush();
+
+                return m_Batch.size();
+            }
+        };
+
+        // Owns the calling thread's ring registration; retires the ring on thread exit
+        struct ThreadRingHandle {
+            ThreadRing* Ring = nullptr;
+
+            ~ThreadRingHandle() {
+                if (Ring) Ring->Retired.store(true, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadRingHandle t_Ring;
+        thread_local LogRecord* t_PendingRecord = nullptr;
+
+        // Used when logging after the backend has been destroyed (static destructors)
+        thread_local LogRecord t_FallbackRecord;
+        LogFormatter s_FallbackFormatter;
+        std::mutex s_FallbackMutex;
+    }
+
+    LogRecord* Log::AcquireRecord() {
+        if (s_State.load(std::memory_order_acquire) == BackendState::ShutDown) {
+            t_PendingRecord = &t_FallbackRecord;
+            return t_PendingRecord;
+        }
+
+        LogBackend& backend = LogBackend::Get();
+        if (!t_Ring.Ring) {
+            t_Ring.Ring = backend.RegisterThread();
+        }
+
+        LogRecord* record = t_Ring.Ring->Buffer.BeginWrite();
+        while (!record) {
+            if (backend.GetOverflowPolicy() == LogOverflowPolicy::Drop) {
+                backend.OnDropped();
+                return nullptr;
+            }
+            backend.Wake();
+            std::this_thread::yield();
+            record = t_Ring.Ring->Buffer.BeginWrite();
+        }
+
+        t_PendingRecord = record;
+        return record;
+    }
+
+    void Log::CommitRecord() {
+        if (t_PendingRecord == &t_FallbackRecord) {
+            std::lock_guard<std::mutex> lock(s_FallbackMutex);
+            s_FallbackFormatter.Write(t_FallbackRecord, &std::cout, nullptr);
+            std::cout.flush();
+            return;
+        }
+
+        t_Ring.Ring->Buffer.EndWrite();
+    }
+
+    void Log::Configure(const LogConfig& config) {
+        LogBackend::Get().Configure(config);
+    }
+
+    void Log::Flush() {
+        if (s_State.load(std::memory_order_acquire) == BackendState::ShutDown) {
+            return;
+        }
+        LogBackend::Get().Flush();
+    }
+
+    uint64_t Log::GetDroppedCount() {
+        if (s_State.load(std::memory_order_acquire) == BackendState::ShutDown) {
+            return 0;
+        }
+        return LogBackend::Get().GetDroppedCount();
+    }
+
+} // namespace BunnyGL
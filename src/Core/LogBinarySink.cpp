@@ -0,0 +1,212 @@
+#include <BunnyGL/Core/LogBinarySink.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace BunnyGL {
+
+    namespace {
+
+        template<typename T>
+        uint8_t* Put(uint8_t* dst, const T& value) {
+            std::memcpy(dst, &value, sizeof(T));
+            return dst + sizeof(T);
+        }
+
+        // Text of an encoded string argument; value points past the type tag
+        std::string_view ReadText(const uint8_t* value) {
+            uint16_t length;
+            std::memcpy(&length, value, sizeof(length));
+            return { reinterpret_cast<const char*>(value + sizeof(length)), length };
+        }
+    }
+
+    LogBinarySink::~LogBinarySink() {
+        Close();
+    }
+
+#ifndef _WIN32
+
+    bool LogBinarySink::Open(const std::string& filepath, size_t initialCapacity) {
+        Close();
+
+        m_FileDescriptor = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_FileDescriptor < 0) {
+            return false;
+        }
+
+        size_t capacity = initialCapacity > sizeof(LogBinaryFormat::FileHeader) ? initialCapacity : 64 * 1024;
+        if (!Remap(capacity)) {
+            ::close(m_FileDescriptor);
+            m_FileDescriptor = -1;
+            return false;
+        }
+
+        LogBinaryFormat::FileHeader header{};
+        std::memcpy(header.Magic, LogBinaryFormat::Magic, sizeof(header.Magic));
+        header.Version = LogBinaryFormat::Version;
+        std::memcpy(m_Mapping, &header, sizeof(header));
+        m_Size = sizeof(header);
+        return true;
+    }
+
+    void LogBinarySink::Close() {
+        if (m_Mapping) {
+            ::munmap(m_Mapping, m_Capacity);
+            m_Mapping = nullptr;
+        }
+        if (m_FileDescriptor >= 0) {
+            // Cut the preallocated tail so the file ends at the last chunk
+            // (if this fails the decoder still stops at the zeroed tail)
+            [[maybe_unused]] int result = ::ftruncate(m_FileDescriptor, static_cast<off_t>(m_Size));
+            ::close(m_FileDescriptor);
+            m_FileDescriptor = -1;
+        }
+        m_Capacity = 0;
+        m_Size = 0;
+        m_Sites.clear();
+    }
+
+    bool LogBinarySink::Remap(size_t capacity) {
+        if (m_Mapping) {
+            ::munmap(m_Mapping, m_Capacity);
+            m_Mapping = nullptr;
+        }
+        if (::ftruncate(m_FileDescriptor, static_cast<off_t>(capacity)) != 0) {
+            return false;
+        }
+        void* mapping = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_FileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            return false;
+        }
+        m_Mapping = static_cast<uint8_t*>(mapping);
+        m_Capacity = capacity;
+        return true;
+    }
+
+#else
+
+    // Memory-mapped output is only implemented for POSIX systems
+    bool LogBinarySink::Open(const std::string&, size_t) { return false; }
+    void LogBinarySink::Close() {}
+    bool LogBinarySink::Remap(size_t) { return false; }
+
+#endif
+
+    uint8_t* LogBinarySink::Reserve(size_t bytes) {
+        if (m_Size + bytes > m_Capacity) {
+            size_t capacity = m_Capacity;
+            while (m_Size + bytes > capacity) capacity *= 2;
+            if (!Remap(capacity)) {
+                // Out of disk or address space: stop logging rather than crash
+                Close();
+                return nullptr;
+            }
+        }
+        uint8_t* dst = m_Mapping + m_Size;
+        m_Size += bytes;
+        return dst;
+    }
+
+    const LogBinarySink::Site& LogBinarySink::GetSite(const LogRecord& record) {
+        SiteKey key{ record.File, record.Line, static_cast<uint8_t>(record.Level), static_cast<uint8_t>(record.Category) };
+        auto it = m_Sites.find(key);
+        if (it != m_Sites.end()) {
+            return it->second;
+        }
+
+        Site site;
+        site.Id = static_cast<uint32_t>(m_Sites.size());
+        size_t literalBytes = 0;
+        for (size_t pos = 0; pos < record.PayloadSize;) {
+            LogArgType type = static_cast<LogArgType>(record.Payload[pos++]);
+            if (type == LogArgType::ConstString && site.Literals.size() < LogBinaryFormat::MaxSiteLiterals) {
+                std::string_view text = ReadText(record.Payload + pos);
+                if (std::find(site.Literals.begin(), site.Literals.end(), text) == site.Literals.end()) {
+                    site.Literals.emplace_back(text);
+                    literalBytes += sizeof(uint16_t) + text.size();
+                }
+            }
+            pos += GetLogArgSize(type, record.Payload + pos);
+        }
+
+        uint16_t length = static_cast<uint16_t>(std::strlen(record.File));
+        uint8_t* dst = Reserve(1 + 4 + 4 + 1 + 1 + 2 + length + 1 + literalBytes);
+        if (dst) {
+            dst = Put(dst, LogBinaryFormat::ChunkType::Site);
+            dst = Put(dst, site.Id);
+            dst = Put(dst, record.Line);
+            dst = Put(dst, key.Level);
+            dst = Put(dst, key.Category);
+            dst = Put(dst, length);
+            std::memcpy(dst, record.File, length);
+            dst += length;
+            dst = Put(dst, static_cast<uint8_t>(site.Literals.size()));
+            for (const std::string& text : site.Literals) {
+                dst = Put(dst, static_cast<uint16_t>(text.size()));
+                std::memcpy(dst, text.data(), text.size());
+                dst += text.size();
+            }
+        }
+        return m_Sites.emplace(key, std::move(site)).first->second;
+    }
+
+    void LogBinarySink::Append(const LogRecord& record) {
+        if (!m_Mapping) {
+            return;
+        }
+        const Site& site = GetSite(record);
+
+        // Known literal text becomes an index into the site's table, the rest
+        // is copied; the payload can only shrink
+        uint8_t payload[LogRecord::PayloadCapacity];
+        size_t size = 0;
+        for (size_t pos = 0; pos < record.PayloadSize;) {
+            LogArgType type = static_cast<LogArgType>(record.Payload[pos]);
+            size_t argSize = 1 + GetLogArgSize(type, record.Payload + pos + 1);
+            auto literal = site.Literals.end();
+            if (type == LogArgType::ConstString) {
+                literal = std::find(site.Literals.begin(), site.Literals.end(), ReadText(record.Payload + pos + 1));
+            }
+            if (literal != site.Literals.end()) {
+                payload[size++] = static_cast<uint8_t>(LogArgType::SiteLiteral);
+                payload[size++] = static_cast<uint8_t>(literal - site.Literals.begin());
+            } else {
+                std::memcpy(payload + size, record.Payload + pos, argSize);
+                // The decoder needs no distinction, and ConstString never reaches the file
+                if (type == LogArgType::ConstString) {
+                    payload[size] = static_cast<uint8_t>(LogArgType::String);
+                }
+                size += argSize;
+            }
+            pos += argSize;
+        }
+
+        uint8_t* dst = Reserve(1 + 4 + 8 + 1 + 2 + size);
+        if (!dst) {
+            return;
+        }
+        dst = Put(dst, LogBinaryFormat::ChunkType::Event);
+        dst = Put(dst, site.Id);
+        dst = Put(dst, record.Timestamp);
+        dst = Put(dst, static_cast<uint8_t>(record.Truncated));
+        dst = Put(dst, static_cast<uint16_t>(size));
+        std::memcpy(dst, payload, size);
+    }
+
+    void LogBinarySink::AppendDropped(uint64_t count) {
+        uint8_t* dst = m_Mapping ? Reserve(1 + 8) : nullptr;
+        if (!dst) {
+            return;
+        }
+        dst = Put(dst, LogBinaryFormat::ChunkType::Dropped);
+        Put(dst, count);
+    }
+
+}
@@ -0,0 +1,94 @@
+#include <BunnyGL/Core/LogFormatter.hpp>
+#include <BunnyGL/Core/Log.hpp>
+
+#include <ctime>
+
+namespace BunnyGL {
+
+    namespace {
+
+        const char* GetSourceFile(const char* filepath) {
+            // Extract just the filename from full path
+            const char* name = filepath;
+            for (const char* p = filepath; *p; ++p) {
+                if (*p == '/' || *p == '\\') name = p + 1;
+            }
+            return name;
+        }
+
+        const char* GetLevelTag(LogLevel level) {
+            switch (level) {
+                case LogLevel::Trace: return "[TRACE]";
+                case LogLevel::Debug: return "[DEBUG]";
+                case LogLevel::Info:  return "[INFO]";
+                case LogLevel::Warn:  return "[WARN]";
+                case LogLevel::Error: return "[ERROR]";
+                case LogLevel::Fatal: return "[FATAL]";
+                default:              return "";
+            }
+        }
+
+        std::string GetLevelColor(LogLevel level) {
+            switch (level) {
+                case LogLevel::Trace: return Colors::WHITE;
+                case LogLevel::Debug: return Colors::CYAN;
+                case LogLevel::Info:  return Colors::GREEN;
+                case LogLevel::Warn:  return Colors::YELLOW;
+                case LogLevel::Error: return Colors::RED;
+                case LogLevel::Fatal: return Colors::BOLD + Colors::RED;
+                default:              return "";
+            }
+        }
+    }
+
+    void LogFormatter::Write(const LogRecord& record, std::ostream* colored, std::ostream* plain) {
+        Write(record, record.Payload, record.PayloadSize, colored, plain);
+    }
+
+    void LogFormatter::Write(const LogRecord& record, const uint8_t* payload, size_t payloadSize,
+                             std::ostream* colored, std::ostream* plain) {
+        m_Message.str("");
+        m_Message.clear();
+        DecodeLogArgs(m_Message, payload, payloadSize);
+        if (record.Truncated) {
+            m_Message << "...";
+        }
+        const std::string message = m_Message.str();
+
+        if (record.Level == LogLevel::Raw) {
+            if (colored) *colored << message << '\n';
+            if (plain) *plain << message << '\n';
+            return;
+        }
+
+        const char* time = FormatTime(record.Timestamp);
+        const char* tag = GetLevelTag(record.Level);
+        const char* source = GetSourceFile(record.File);
+
+        if (colored) {
+            *colored << GetLevelColor(record.Level) << "[" << time << "]" << tag
+                     << "[" << source << "] " << message << Colors::RESET << '\n';
+        }
+        if (plain) {
+            *plain << "[" << time << "]" << tag << "[" << source << "] " << message << '\n';
+        }
+    }
+
+    // localtime is only called once per second of log output
+    const char* LogFormatter::FormatTime(int64_t timestampNs) {
+        int64_t second = timestampNs / 1000000000;
+        if (second != m_CachedSecond) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm local{};
+#ifdef _WIN32
+            localtime_s(&local, &time);
+#else
+            localtime_r(&time, &local);
+#endif
+            std::strftime(m_CachedTime, sizeof(m_CachedTime), "%H:%M:%S", &local);
+            m_CachedSecond = second;
+        }
+        return m_CachedTime;
+    }
+
+}
@@ -0,0 +1,277 @@
+#include <BunnyGL/Core/Profiler.hpp>
+#include <BunnyGL/Core/Log.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace BunnyGL {
+
+    namespace {
+
+        // Fixed block of events; the owning thread appends, exporters read up to Count
+        struct ProfileChunk {
+            static constexpr size_t Capacity = 4096;
+
+            ProfileEvent Events[Capacity];
+            std::atomic<size_t> Count{0};
+            std::atomic<ProfileChunk*> Next{nullptr};
+        };
+
+        struct ThreadBuffer {
+            uint32_t ThreadId = 0;
+            std::string Name;
+            ProfileChunk* Head = nullptr;   // Never changes after creation
+            ProfileChunk* Tail = nullptr;   // Owner thread only
+
+            ~ThreadBuffer() {
+                ProfileChunk* chunk = Head;
+                while (chunk) {
+                    ProfileChunk* next = chunk->Next.load(std::memory_order_relaxed);
+                    delete chunk;
+                    chunk = next;
+                }
+            }
+        };
+
+        struct ProfilerState {
+            std::mutex Mutex;           // Registration, naming and capture settings only
+            std::vector<std::unique_ptr<ThreadBuffer>> Threads;
+            std::string CapturePath;
+            bool ExportPending = false;         // Capture range over, waiting for retained frames
+            std::vector<uint32_t> RetainedFrames;
+            const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+        };
+
+        ProfilerState& GetState() {
+            static ProfilerState s_State;
+            return s_State;
+        }
+
+        thread_local ThreadBuffer* t_Buffer = nullptr;
+        thread_local uint32_t t_Depth = 0;
+
+        ThreadBuffer* CreateBuffer(const std::string& name) {
+            ProfilerState& state = GetState();
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->Head = buffer->Tail = new ProfileChunk();
+
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            buffer->ThreadId = static_cast<uint32_t>(state.Threads.size()) + 1;
+            buffer->Name = name.empty() ? "Thread " + std::to_string(buffer->ThreadId) : name;
+            state.Threads.push_back(std::move(buffer));
+            return state.Threads.back().get();
+        }
+
+        ThreadBuffer* GetThreadBuffer() {
+            if (!t_Buffer) {
+                t_Buffer = CreateBuffer("");
+            }
+            return t_Buffer;
+        }
+
+        void AppendEvent(ThreadBuffer* buffer, const ProfileEvent& event) {
+            ProfileChunk* chunk = buffer->Tail;
+
+            size_t index = chunk->Count.load(std::memory_order_relaxed);
+            if (index == ProfileChunk::Capacity) {
+                ProfileChunk* next = new ProfileChunk();
+                chunk->Next.store(next, std::memory_order_release);
+                buffer->Tail = chunk = next;
+                index = 0;
+            }
+
+            chunk->Events[index] = event;
+            chunk->Count.store(index + 1, std::memory_order_release);
+        }
+
+        void WriteJsonString(std::ostream& out, const char* str) {
+            out << '"';
+            for (const char* c = str; *c; ++c) {
+                switch (*c) {
+                    case '"':  out << "\\\""; break;
+                    case '\\': out << "\\\\"; break;
+                    case '\n': out << "\\n"; break;
+                    default:
+                        if (static_cast<unsigned char>(*c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                            out << escaped;
+                        } else {
+                            out << *c;
+                        }
+                }
+            }
+            out << '"';
+        }
+    }
+
+    int64_t Profiler::Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - GetState().Epoch).count();
+    }
+
+    uint32_t& Profiler::ThreadDepth() {
+        return t_Depth;
+    }
+
+    void Profiler::RecordZone(const char* name, int64_t start, int64_t end, uint32_t depth) {
+        AppendEvent(GetThreadBuffer(), { name, start, end, depth, GetThreadFrame() });
+    }
+
+    uint32_t Profiler::CreateTrack(const std::string& name) {
+        return CreateBuffer(name)->ThreadId;
+    }
+
+    void Profiler::RecordTrackZone(uint32_t track, const char* name, int64_t start, int64_t end, uint32_t depth, uint32_t frame) {
+        ThreadBuffer* buffer = nullptr;
+        {
+            ProfilerState& state = GetState();
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            if (track == 0 || track > state.Threads.size()) {
+                return;
+            }
+            buffer = state.Threads[track - 1].get();
+        }
+        AppendEvent(buffer, { name, start, end, depth, frame });
+    }
+
+    void Profiler::SetThreadName(const std::string& name) {
+        ThreadBuffer* buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(GetState().Mutex);
+        buffer->Name = name;
+    }
+
+    void Profiler::SetCapture(uint32_t firstFrame, uint32_t lastFrame, const std::string& outputPath) {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        s_CaptureFirst.store(firstFrame, std::memory_order_relaxed);
+        s_CaptureLast.store(lastFrame, std::memory_order_relaxed);
+        state.CapturePath = outputPath;
+        state.ExportPending = false;
+
+        uint32_t frame = s_Frame.load(std::memory_order_relaxed);
+        s_Recording.store(frame >= firstFrame && frame <= lastFrame, std::memory_order_relaxed);
+    }
+
+    void Profiler::BeginFrame() {
+        ProfilerState& state = GetState();
+        uint32_t frame = s_Frame.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        {
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            uint32_t first = s_CaptureFirst.load(std::memory_order_relaxed);
+            uint32_t last = s_CaptureLast.load(std::memory_order_relaxed);
+            s_Recording.store(frame >= first && frame <= last, std::memory_order_relaxed);
+
+            if (frame == last + 1 && !state.CapturePath.empty()) {
+                state.ExportPending = true;
+            }
+        }
+        TryExportCapture();
+    }
+
+    void Profiler::RetainFrame(uint32_t frame) {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        state.RetainedFrames.push_back(frame);
+    }
+
+    void Profiler::ReleaseFrame(uint32_t frame) {
+        ProfilerState& state = GetState();
+        {
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            auto it = std::find(state.RetainedFrames.begin(), state.RetainedFrames.end(), frame);
+            if (it != state.RetainedFrames.end()) {
+                state.RetainedFrames.erase(it);
+            }
+        }
+        TryExportCapture();
+    }
+
+    // Writes the capture once its range is over and no thread still works
+    // on a frame inside it
+    void Profiler::TryExportCapture() {
+        ProfilerState& state = GetState();
+        std::string path;
+        uint32_t first, last;
+        {
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            first = s_CaptureFirst.load(std::memory_order_relaxed);
+            last = s_CaptureLast.load(std::memory_order_relaxed);
+            if (!state.ExportPending) {
+                return;
+            }
+            for (uint32_t frame : state.RetainedFrames) {
+                if (frame <= last) {
+                    return;
+                }
+            }
+            path = std::move(state.CapturePath);
+            state.CapturePath.clear();
+            state.ExportPending = false;
+        }
+        ExportChromeTrace(path, first, last);
+    }
+
+    bool Profiler::ExportChromeTrace(const std::string& path, uint32_t firstFrame, uint32_t lastFrame) {
+        std::ofstream out(path, std::ios::out | std::ios::trunc);
+        if (!out.is_open()) {
+            BG_ERROR("Failed to open trace file ", path);
+            return false;
+        }
+
+        ProfilerState& state = GetState();
+        std::vector<ThreadBuffer*> threads;
+        std::vector<std::string> names;
+        {
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            for (const auto& buffer : state.Threads) {
+                threads.push_back(buffer.get());
+                names.push_back(buffer->Name);
+            }
+        }
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        size_t eventCount = 0;
+        char number[64];
+
+        for (size_t i = 0; i < threads.size(); ++i) {
+            out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+                << threads[i]->ThreadId << ",\"args\":{\"name\":";
+            WriteJsonString(out, names[i].c_str());
+            out << "}}";
+            first = false;
+
+            for (ProfileChunk* chunk = threads[i]->Head; chunk; chunk = chunk->Next.load(std::memory_order_acquire)) {
+                size_t count = chunk->Count.load(std::memory_order_acquire);
+                for (size_t e = 0; e < count; ++e) {
+                    const ProfileEvent& event = chunk->Events[e];
+                    if (event.Frame < firstFrame || event.Frame > lastFrame) {
+                        continue;
+                    }
+
+                    out << ",\n{\"ph\":\"X\",\"cat\":\"cpu\",\"name\":";
+                    WriteJsonString(out, event.Name);
+                    std::snprintf(number, sizeof(number), "%.3f", event.Start / 1000.0);
+                    out << ",\"ts\":" << number;
+                    std::snprintf(number, sizeof(number), "%.3f", (event.End - event.Start) / 1000.0);
+                    out << ",\"dur\":" << number
+                        << ",\"pid\":1,\"tid\":" << threads[i]->ThreadId
+                        << ",\"args\":{\"frame\":" << event.Frame << ",\"depth\":" << event.Depth << "}}";
+                    eventCount++;
+                }
+            }
+        }
+        out << "\n]}\n";
+
+        BG_INFO("Wrote ", eventCount, " profile zones (frames ", firstFrame, "-", lastFrame, ") to ", path);
+        return true;
+    }
+
+}
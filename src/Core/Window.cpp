@@ -1,8 +1,14 @@
 #include <BunnyGL/Core/Window.hpp>
 #include <BunnyGL/Core/Log.hpp>
 
+#include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#ifdef BG_HAS_EGL
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
 
 namespace BunnyGL {
 
@@ -10,9 +16,23 @@ namespace BunnyGL {
         BG_ERROR("GLFW Error (", error, "): ", description);
     }
 
-    Window::Window(int width, int height, const std::string& title) : m_Width(width), m_Height(height) {
+    Window::Window(const WindowSpecification& spec) : m_Width(spec.Width), m_Height(spec.Height), m_Headless(spec.Headless) {
+
+        if (m_Headless) {
+            CreateHeadless(spec);
+        } else {
+            CreateWindowed(spec);
+        }
+
+        // Disable VSync initially for better debugging
+        SetSwapInterval(0);
+
+        BG_INFO("Window created successfully");
+    }
+
+    void Window::CreateWindowed(const WindowSpecification& spec) {
 
-        BG_INFO("Creating window '", title, "' (", width, "x", height,")");
+        BG_INFO("Creating window '", spec.Title, "' (", spec.Width, "x", spec.Height,")");
 
         // Initialize GLFW
         if (!glfwInit()) {
@@ -31,7 +51,7 @@ namespace BunnyGL {
         #endif
 
         // Create the window
-        m_Window = glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
+        m_Window = glfwCreateWindow(spec.Width, spec.Height, spec.Title.c_str(), nullptr, nullptr);
         if (!m_Window) {
             glfwTerminate();
             BG_FATAL("Failed to create GLFW window");
@@ -40,28 +60,199 @@ namespace BunnyGL {
         // Make OpenGL context current
         glfwMakeContextCurrent(m_Window);
 
-        // Disable VSync initially for better debugging
-        glfwSwapInterval(0);
+        LoadGL([](const char* name) { return reinterpret_cast<void*>(glfwGetProcAddress(name)); });
+    }
 
-        BG_INFO("Window created successfully");
+#ifdef BG_HAS_EGL
+
+    void Window::CreateHeadless(const WindowSpecification& spec) {
+
+        BG_INFO("Creating headless context '", spec.Title, "' (", spec.Width, "x", spec.Height, ")");
+
+        // Prefer Mesa's surfaceless platform: no X11/Wayland and no GPU required
+        EGLDisplay display = EGL_NO_DISPLAY;
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        if (display == EGL_NO_DISPLAY) {
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+
+        EGLint major = 0, minor = 0;
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+            BG_FATAL("Failed to initialize EGL display");
+        }
+        BG_INFO("EGL ", major, ".", minor, " (", eglQueryString(display, EGL_VENDOR), ")");
+
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            BG_FATAL("EGL implementation has no desktop OpenGL support");
+        }
+
+        const EGLint configAttributes[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_SURFACE_TYPE, 0,
+            EGL_NONE
+        };
+        EGLConfig config = nullptr;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+            // Surfaceless contexts do not need a config at all
+            config = nullptr;
+        }
+
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+        if (context == EGL_NO_CONTEXT) {
+            eglTerminate(display);
+            BG_FATAL("Failed to create EGL context");
+        }
+
+        if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+            eglDestroyContext(display, context);
+            eglTerminate(display);
+            BG_FATAL("Failed to make surfaceless EGL context current");
+        }
+
+        m_EGLDisplay = display;
+        m_EGLContext = context;
+
+        LoadGL([](const char* name) { return reinterpret_cast<void*>(eglGetProcAddress(name)); });
+
+        // Offscreen render target standing in for the default framebuffer
+        glGenRenderbuffers(1, &m_ColorBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_ColorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_Width, m_Height);
+
+        glGenRenderbuffers(1, &m_DepthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_DepthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_Width, m_Height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &m_Framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorBuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            BG_FATAL("Offscreen framebuffer is incomplete");
+        }
+        glViewport(0, 0, m_Width, m_Height);
+    }
+
+#else
+
+    void Window::CreateHeadless(const WindowSpecification&) {
+        BG_FATAL("Headless mode requested, but BunnyGL was built without EGL");
+    }
+
+#endif
+
+    void Window::LoadGL(void* (*loader)(const char*)) {
+        m_ProcLoader = loader;
+        // Initialize OpenGL loader (GLAD)
+        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(loader))) {
+            BG_FATAL("Failed to initialize GLAD");
+        }
+    }
+
+    void* Window::GetProcAddress(const char* name) const {
+        return m_ProcLoader ? m_ProcLoader(name) : nullptr;
     }
 
     Window::~Window() {
-        glfwDestroyWindow(m_Window);
-        glfwTerminate();
+        if (m_Headless) {
+#ifdef BG_HAS_EGL
+            if (m_Framebuffer) glDeleteFramebuffers(1, &m_Framebuffer);
+            if (m_ColorBuffer) glDeleteRenderbuffers(1, &m_ColorBuffer);
+            if (m_DepthBuffer) glDeleteRenderbuffers(1, &m_DepthBuffer);
+
+            EGLDisplay display = static_cast<EGLDisplay>(m_EGLDisplay);
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(display, static_cast<EGLContext>(m_EGLContext));
+            eglTerminate(display);
+#endif
+        } else {
+            glfwDestroyWindow(m_Window);
+            glfwTerminate();
+        }
         BG_INFO("Window destroyed");
     }
 
     void Window::SwapBuffers() {
+        if (m_Headless) {
+            // Nothing to present; just hand the frame to the driver
+            glFlush();
+            return;
+        }
         glfwSwapBuffers(m_Window);
     }
 
     void Window::PollEvents() {
-        glfwPollEvents();
+        if (!m_Headless) {
+            glfwPollEvents();
+        }
     }
 
     bool Window::ShouldClose() const {
-        return glfwWindowShouldClose(m_Window);
+        if (m_Headless) {
+            return m_CloseRequested;
+        }
+        return m_CloseRequested || glfwWindowShouldClose(m_Window);
+    }
+
+    void Window::Close() {
+        m_CloseRequested = true;
+    }
+
+    void Window::SetSwapInterval(int interval) {
+        if (!m_Headless) {
+            glfwSwapInterval(interval);
+        }
+        m_SwapInterval = interval;
+    }
+
+    int Window::GetRefreshRate() const {
+        if (m_Headless) {
+            return 0;
+        }
+        GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+        if (!monitor) {
+            return 0;
+        }
+        const GLFWvidmode* mode = glfwGetVideoMode(monitor);
+        return mode ? mode->refreshRate : 0;
+    }
+
+    void Window::MakeContextCurrent() {
+        if (m_Headless) {
+#ifdef BG_HAS_EGL
+            eglMakeCurrent(static_cast<EGLDisplay>(m_EGLDisplay), EGL_NO_SURFACE, EGL_NO_SURFACE, static_cast<EGLContext>(m_EGLContext));
+#endif
+            return;
+        }
+        glfwMakeContextCurrent(m_Window);
+    }
+
+    void Window::ReleaseContext() {
+        if (m_Headless) {
+#ifdef BG_HAS_EGL
+            eglMakeCurrent(static_cast<EGLDisplay>(m_EGLDisplay), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+#endif
+            return;
+        }
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    void Window::ReadPixels(std::vector<unsigned char>& pixels) const {
+        pixels.resize(static_cast<size_t>(m_Width) * m_Height * 4);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
     }
 
-}
\ No newline at end of file
+}
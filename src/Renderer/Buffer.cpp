@@ -0,0 +1,59 @@
+#include <BunnyGL/Renderer/Buffer.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Core/Log.hpp>
+
+#include <glad/glad.h>
+
+namespace BunnyGL {
+
+    namespace {
+        GLenum ToGL(BufferType type) {
+            switch (type) {
+                case BufferType::Vertex:    return GL_ARRAY_BUFFER;
+                case BufferType::Index:     return GL_ELEMENT_ARRAY_BUFFER;
+                case BufferType::Uniform:   return GL_UNIFORM_BUFFER;
+            }
+            return GL_ARRAY_BUFFER;
+        }
+
+        GLenum ToGL(BufferUsage usage) {
+            return usage == BufferUsage::Dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+        }
+    }
+
+    Buffer::Buffer(BufferType type, const void* data, size_t size, BufferUsage usage)
+        : m_Type(type), m_Usage(usage), m_Size(size) {
+        glGenBuffers(1, &m_RendererID);
+        // Uploads go through the copy target so they never touch the bound
+        // vertex array's element buffer or the cached bindings
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data, ToGL(usage));
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    Buffer::~Buffer() {
+        if (m_RendererID != 0) {
+            glDeleteBuffers(1, &m_RendererID);
+            // The name can be reused by the next glGenBuffers
+            RenderStateCache::Invalidate();
+        }
+    }
+
+    void Buffer::SetData(const void* data, size_t size, size_t offset) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        if (offset + size > m_Size) {
+            if (offset != 0) {
+                BG_WARN("Buffer ", m_RendererID, " grown by a partial write, previous contents are lost");
+            }
+            m_Size = offset + size;
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(m_Size), nullptr, ToGL(m_Usage));
+        }
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    void Buffer::Bind() const {
+        RenderStateCache::BindBuffer(ToGL(m_Type), m_RendererID);
+    }
+
+}
@@ -0,0 +1,232 @@
+#include <BunnyGL/Renderer/CommandList.hpp>
+#include <BunnyGL/Renderer/Shader.hpp>
+
+#include <glad/glad.h>
+
+#include <cstring>
+
+namespace BunnyGL {
+
+    namespace {
+        GLenum ToGL(PrimitiveType primitive) {
+            switch (primitive) {
+                case PrimitiveType::Triangles:     return GL_TRIANGLES;
+                case PrimitiveType::TriangleStrip: return GL_TRIANGLE_STRIP;
+                case PrimitiveType::Lines:         return GL_LINES;
+                case PrimitiveType::Points:        return GL_POINTS;
+            }
+            return GL_TRIANGLES;
+        }
+
+        void ApplyUniform(Shader& shader, const RenderCommand& command) {
+            const float* v = command.Floats;
+            switch (command.ValueType) {
+                case UniformType::Int:   shader.SetUniform(command.Uniform, static_cast<int>(command.Int)); break;
+                case UniformType::Float: shader.SetUniform(command.Uniform, v[0]); break;
+                case UniformType::Vec2:  shader.SetUniform(command.Uniform, glm::vec2(v[0], v[1])); break;
+                case UniformType::Vec3:  shader.SetUniform(command.Uniform, glm::vec3(v[0], v[1], v[2])); break;
+                case UniformType::Vec4:  shader.SetUniform(command.Uniform, glm::vec4(v[0], v[1], v[2], v[3])); break;
+                case UniformType::Mat3: {
+                    glm::mat3 matrix;
+                    std::memcpy(&matrix[0][0], v, 9 * sizeof(float));
+                    shader.SetUniform(command.Uniform, matrix);
+                    break;
+                }
+                case UniformType::Mat4: {
+                    glm::mat4 matrix;
+                    std::memcpy(&matrix[0][0], v, 16 * sizeof(float));
+                    shader.SetUniform(command.Uniform, matrix);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+
+    void CommandList::Reset() {
+        m_Commands.clear();
+        m_UniformData.clear();
+        m_Callbacks.clear();
+    }
+
+    RenderCommand& CommandList::Push(RenderCommandType type) {
+        RenderCommand& command = m_Commands.emplace_back();
+        command.Type = type;
+        return command;
+    }
+
+    void CommandList::PushUniform(UniformHandle uniform, UniformType type, const float* values, size_t count) {
+        RenderCommand& command = Push(RenderCommandType::SetUniform);
+        command.ValueType = type;
+        command.Uniform = uniform;
+        std::memcpy(command.Floats, values, count * sizeof(float));
+    }
+
+    void CommandList::Clear(const glm::vec4& color) {
+        RenderCommand& command = Push(RenderCommandType::Clear);
+        std::memcpy(command.Color, &color[0], sizeof(command.Color));
+    }
+
+    void CommandList::SetViewport(int x, int y, int width, int height) {
+        RenderCommand& command = Push(RenderCommandType::SetViewport);
+        command.Rect[0] = x;
+        command.Rect[1] = y;
+        command.Rect[2] = width;
+        command.Rect[3] = height;
+    }
+
+    void CommandList::BindShader(Shader* shader) {
+        Push(RenderCommandType::BindShader).ShaderPtr = shader;
+    }
+
+    void CommandList::BindPipeline(const PipelineState* pipeline) {
+        Push(RenderCommandType::BindPipeline).Pipeline = pipeline;
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, int value) {
+        RenderCommand& command = Push(RenderCommandType::SetUniform);
+        command.ValueType = UniformType::Int;
+        command.Uniform = uniform;
+        command.Int = value;
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, float value) {
+        PushUniform(uniform, UniformType::Float, &value, 1);
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, const glm::vec2& value) {
+        PushUniform(uniform, UniformType::Vec2, &value[0], 2);
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, const glm::vec3& value) {
+        PushUniform(uniform, UniformType::Vec3, &value[0], 3);
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, const glm::vec4& value) {
+        PushUniform(uniform, UniformType::Vec4, &value[0], 4);
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, const glm::mat3& value) {
+        PushUniform(uniform, UniformType::Mat3, &value[0][0], 9);
+    }
+
+    void CommandList::SetUniform(UniformHandle uniform, const glm::mat4& value) {
+        PushUniform(uniform, UniformType::Mat4, &value[0][0], 16);
+    }
+
+    UniformAllocation CommandList::AllocateUniforms(const void* data, uint32_t size) {
+        if (size == 0) {
+            return UniformAllocation{};
+        }
+        uint32_t alignment = UniformArena::GetOffsetAlignment();
+        uint32_t offset = (static_cast<uint32_t>(m_UniformData.size()) + alignment - 1) / alignment * alignment;
+        m_UniformData.resize(offset + size);
+        std::memcpy(m_UniformData.data() + offset, data, size);
+        return UniformAllocation{ offset, size };
+    }
+
+    void CommandList::BindUniformBlock(uint32_t binding, UniformAllocation allocation) {
+        RenderCommand& command = Push(RenderCommandType::BindUniformBlock);
+        command.Index = binding;
+        command.Block = allocation;
+    }
+
+    void CommandList::BindVertexArray(uint32_t vertexArray) {
+        Push(RenderCommandType::BindVertexArray).Handle = vertexArray;
+    }
+
+    void CommandList::BindTexture(uint32_t unit, uint32_t texture) {
+        RenderCommand& command = Push(RenderCommandType::BindTexture);
+        command.Index = unit;
+        command.Handle = texture;
+    }
+
+    void CommandList::DrawArrays(PrimitiveType primitive, uint32_t first, uint32_t count) {
+        RenderCommand& command = Push(RenderCommandType::DrawArrays);
+        command.Primitive = primitive;
+        command.Index = first;
+        command.Count = count;
+    }
+
+    void CommandList::DrawIndexed(PrimitiveType primitive, uint32_t indexCount, IndexFormat format) {
+        RenderCommand& command = Push(RenderCommandType::DrawIndexed);
+        command.Primitive = primitive;
+        command.Index = static_cast<uint32_t>(format);
+        command.Count = indexCount;
+    }
+
+    void CommandList::Submit(std::function<void()> callback) {
+        uint32_t index = static_cast<uint32_t>(m_Callbacks.size());
+        m_Callbacks.push_back(std::move(callback));
+        Push(RenderCommandType::Callback).Index = index;
+    }
+
+    void CommandList::Execute() const {
+        Shader* shader = nullptr;
+
+        // Every block of the frame in one upload
+        uint32_t uniformBase = 0;
+        if (!m_UniformData.empty()) {
+            uniformBase = UniformArena::Upload(m_UniformData.data(), static_cast<uint32_t>(m_UniformData.size()));
+        }
+
+        for (const RenderCommand& command : m_Commands) {
+            switch (command.Type) {
+                case RenderCommandType::Clear:
+                    RenderStateCache::SetClearColor(command.Color[0], command.Color[1], command.Color[2], command.Color[3]);
+                    RenderStateCache::SetDepthWrite(true);
+                    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                    break;
+                case RenderCommandType::SetViewport:
+                    RenderStateCache::SetViewport(command.Rect[0], command.Rect[1], command.Rect[2], command.Rect[3]);
+                    break;
+                case RenderCommandType::BindShader:
+                    shader = command.ShaderPtr;
+                    RenderStateCache::UseProgram(shader ? shader->GetRendererID() : 0);
+                    break;
+                case RenderCommandType::BindPipeline:
+                    shader = command.Pipeline ? command.Pipeline->GetShader() : nullptr;
+                    if (command.Pipeline) {
+                        RenderStateCache::ApplyPipeline(*command.Pipeline);
+                    } else {
+                        RenderStateCache::UseProgram(0);
+                    }
+                    break;
+                case RenderCommandType::SetUniform:
+                    if (shader) {
+                        ApplyUniform(*shader, command);
+                    }
+                    break;
+                case RenderCommandType::BindUniformBlock:
+                    if (command.Block.IsValid()) {
+                        RenderStateCache::BindBufferRange(command.Index, UniformArena::GetBuffer(),
+                                                          uniformBase + command.Block.Offset, command.Block.Size);
+                    }
+                    break;
+                case RenderCommandType::BindVertexArray:
+                    RenderStateCache::BindVertexArray(command.Handle);
+                    break;
+                case RenderCommandType::BindTexture:
+                    RenderStateCache::BindTexture(command.Index, GL_TEXTURE_2D, command.Handle);
+                    break;
+                case RenderCommandType::DrawArrays:
+                    glDrawArrays(ToGL(command.Primitive), static_cast<GLint>(command.Index), static_cast<GLsizei>(command.Count));
+                    break;
+                case RenderCommandType::DrawIndexed:
+                    glDrawElements(ToGL(command.Primitive), static_cast<GLsizei>(command.Count),
+                                   command.Index == static_cast<uint32_t>(IndexFormat::UInt16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, nullptr);
+                    break;
+                case RenderCommandType::Callback:
+                    m_Callbacks[command.Index]();
+                    RenderStateCache::Invalidate();
+                    break;
+            }
+        }
+
+        if (!m_UniformData.empty()) {
+            UniformArena::EndFrame();
+        }
+    }
+
+}
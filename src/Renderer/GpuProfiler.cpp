@@ -0,0 +1,277 @@
+#include <BunnyGL/Renderer/GpuProfiler.hpp>
+#include <BunnyGL/Core/Log.hpp>
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <mutex>
+
+namespace BunnyGL {
+
+    namespace {
+
+        struct GpuZone {
+            const char* Name;
+            uint32_t Depth;
+            bool Closed;
+            bool Captured;          // Profiler was recording when the zone began
+            int64_t CpuStart;       // Used in the software fallback
+            int64_t CpuEnd;
+        };
+
+        struct FrameSlot {
+            uint32_t Frame = 0;
+            uint32_t ZoneCount = 0;
+            bool Pending = false;
+            GLuint LastQuery = 0;   // Most recently issued query of the frame
+            GpuZone Zones[GpuProfiler::MaxZonesPerFrame];
+            GLuint Queries[GpuProfiler::MaxZonesPerFrame * 2] = {};
+        };
+
+        struct GpuProfilerState {
+            bool Initialized = false;
+            bool Hardware = false;
+            FrameSlot Slots[GpuProfiler::FramesInFlight];
+            uint32_t CurrentSlot = 0;
+            uint32_t Depth = 0;
+            uint32_t Track = 0;
+            int64_t ClockOffset = 0;        // Profiler::Now() - GPU timestamp
+            uint32_t FramesSinceCalibration = 0;
+        };
+
+        // Written on the GL thread, read from any (the render thread may own GL)
+        struct ResultState {
+            std::mutex Mutex;
+            GpuFrameResult Last;
+            GpuFrameResult Queue[GpuProfiler::MaxQueuedResults];    // Ring, for DrainResults
+            uint32_t QueueHead = 0;
+            uint32_t QueueCount = 0;
+            uint64_t DroppedFrames = 0;
+        };
+
+        GpuProfilerState s_State;
+        ResultState s_Results;
+
+        bool IsSoftwareRenderer() {
+            const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+            if (!renderer) {
+                return true;
+            }
+            for (const char* name : { "llvmpipe", "softpipe", "SwiftShader", "Software Rasterizer" }) {
+                if (std::strstr(renderer, name)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // GPU and CPU clocks drift apart, so the offset is refreshed periodically
+        void Calibrate() {
+            GLint64 gpuNow = 0;
+            glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+            s_State.ClockOffset = Profiler::Now() - static_cast<int64_t>(gpuNow);
+            s_State.FramesSinceCalibration = 0;
+        }
+
+        // Reads a slot back if all of its queries have landed; never blocks
+        bool TryResolve(FrameSlot& slot) {
+            if (!slot.Pending) {
+                return true;
+            }
+
+            if (s_State.Hardware && slot.LastQuery != 0) {
+                // Queries complete in submission order, so the last one decides
+                GLint available = 0;
+                glGetQueryObjectiv(slot.LastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available) {
+                    return false;
+                }
+            }
+
+            double frameTimeMs = 0.0;
+            for (uint32_t i = 0; i < slot.ZoneCount; ++i) {
+                GpuZone& zone = slot.Zones[i];
+                if (!zone.Closed) {
+                    continue;
+                }
+
+                int64_t start = zone.CpuStart;
+                int64_t end = zone.CpuEnd;
+                if (s_State.Hardware) {
+                    GLuint64 gpuStart = 0, gpuEnd = 0;
+                    glGetQueryObjectui64v(slot.Queries[i * 2], GL_QUERY_RESULT, &gpuStart);
+                    glGetQueryObjectui64v(slot.Queries[i * 2 + 1], GL_QUERY_RESULT, &gpuEnd);
+                    start = static_cast<int64_t>(gpuStart) + s_State.ClockOffset;
+                    end = static_cast<int64_t>(gpuEnd) + s_State.ClockOffset;
+                }
+
+                if (zone.Depth == 0) {
+                    frameTimeMs += (end - start) / 1000000.0;
+                }
+                if (zone.Captured) {
+                    Profiler::RecordTrackZone(s_State.Track, zone.Name, start, end, zone.Depth, slot.Frame);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(s_Results.Mutex);
+                s_Results.Last = { slot.Frame, frameTimeMs };
+                uint32_t tail = (s_Results.QueueHead + s_Results.QueueCount) % GpuProfiler::MaxQueuedResults;
+                s_Results.Queue[tail] = s_Results.Last;
+                if (s_Results.QueueCount < GpuProfiler::MaxQueuedResults) {
+                    s_Results.QueueCount++;
+                } else {
+                    s_Results.QueueHead = (s_Results.QueueHead + 1) % GpuProfiler::MaxQueuedResults;
+                }
+            }
+            slot.Pending = false;
+            return true;
+        }
+    }
+
+    void GpuProfiler::Init() {
+        if (s_State.Initialized) {
+            return;
+        }
+
+        GLint counterBits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+        s_State.Hardware = counterBits > 0 && !IsSoftwareRenderer();
+
+        if (s_State.Hardware) {
+            for (FrameSlot& slot : s_State.Slots) {
+                glGenQueries(MaxZonesPerFrame * 2, slot.Queries);
+            }
+            Calibrate();
+            s_State.Track = Profiler::CreateTrack("GPU");
+            BG_INFO("GPU profiler: timestamp queries (", counterBits, " bits)");
+        } else {
+            s_State.Track = Profiler::CreateTrack("GPU (CPU-timed)");
+            BG_INFO("GPU profiler: software renderer, falling back to CPU-side timing");
+        }
+
+        s_State.Initialized = true;
+    }
+
+    void GpuProfiler::Shutdown() {
+        if (!s_State.Initialized) {
+            return;
+        }
+        if (s_State.Hardware) {
+            for (FrameSlot& slot : s_State.Slots) {
+                glDeleteQueries(MaxZonesPerFrame * 2, slot.Queries);
+            }
+        }
+        uint32_t track = s_State.Track;
+        s_State = GpuProfilerState();
+        s_State.Track = track;  // Tracks are never removed from the profiler
+
+        std::lock_guard<std::mutex> lock(s_Results.Mutex);
+        s_Results.Last = GpuFrameResult();
+        s_Results.QueueHead = 0;
+        s_Results.QueueCount = 0;
+        s_Results.DroppedFrames = 0;
+    }
+
+    void GpuProfiler::BeginFrame(uint32_t frame) {
+        if (!s_State.Initialized) {
+            return;
+        }
+
+        // Oldest first, so the last result only moves forward
+        for (uint32_t i = 1; i <= FramesInFlight; ++i) {
+            FrameSlot& slot = s_State.Slots[(s_State.CurrentSlot + i) % FramesInFlight];
+            if (!TryResolve(slot)) {
+                break;
+            }
+        }
+
+        s_State.CurrentSlot = (s_State.CurrentSlot + 1) % FramesInFlight;
+        FrameSlot& slot = s_State.Slots[s_State.CurrentSlot];
+        if (slot.Pending) {
+            // GPU more than FramesInFlight frames behind; give up on this one rather than wait
+            std::lock_guard<std::mutex> lock(s_Results.Mutex);
+            s_Results.DroppedFrames++;
+        }
+
+        slot.Frame = frame;
+        slot.ZoneCount = 0;
+        slot.LastQuery = 0;
+        slot.Pending = true;
+        s_State.Depth = 0;
+
+        if (s_State.Hardware && ++s_State.FramesSinceCalibration >= 120) {
+            Calibrate();
+        }
+    }
+
+    int GpuProfiler::BeginZone(const char* name) {
+        if (!s_State.Initialized) {
+            return -1;
+        }
+
+        FrameSlot& slot = s_State.Slots[s_State.CurrentSlot];
+        if (slot.ZoneCount >= MaxZonesPerFrame) {
+            return -1;
+        }
+
+        int index = static_cast<int>(slot.ZoneCount++);
+        GpuZone& zone = slot.Zones[index];
+        zone.Name = name;
+        zone.Depth = s_State.Depth++;
+        zone.Closed = false;
+        zone.Captured = Profiler::IsRecording();
+
+        if (s_State.Hardware) {
+            slot.LastQuery = slot.Queries[index * 2];
+            glQueryCounter(slot.LastQuery, GL_TIMESTAMP);
+        } else {
+            zone.CpuStart = Profiler::Now();
+        }
+        return index;
+    }
+
+    void GpuProfiler::EndZone(int zone) {
+        if (zone < 0) {
+            return;
+        }
+
+        FrameSlot& slot = s_State.Slots[s_State.CurrentSlot];
+        if (static_cast<uint32_t>(zone) >= slot.ZoneCount) {
+            return; // Zone from a previous frame
+        }
+
+        s_State.Depth--;
+        slot.Zones[zone].Closed = true;
+        if (s_State.Hardware) {
+            slot.LastQuery = slot.Queries[zone * 2 + 1];
+            glQueryCounter(slot.LastQuery, GL_TIMESTAMP);
+        } else {
+            slot.Zones[zone].CpuEnd = Profiler::Now();
+        }
+    }
+
+    bool GpuProfiler::IsHardwareTimed() {
+        return s_State.Hardware;
+    }
+
+    GpuFrameResult GpuProfiler::GetLastResult() {
+        std::lock_guard<std::mutex> lock(s_Results.Mutex);
+        return s_Results.Last;
+    }
+
+    void GpuProfiler::DrainResults(std::vector<GpuFrameResult>& results) {
+        std::lock_guard<std::mutex> lock(s_Results.Mutex);
+        for (uint32_t i = 0; i < s_Results.QueueCount; ++i) {
+            results.push_back(s_Results.Queue[(s_Results.QueueHead + i) % MaxQueuedResults]);
+        }
+        s_Results.QueueHead = 0;
+        s_Results.QueueCount = 0;
+    }
+
+    uint64_t GpuProfiler::GetDroppedFrames() {
+        std::lock_guard<std::mutex> lock(s_Results.Mutex);
+        return s_Results.DroppedFrames;
+    }
+
+}
@@ -0,0 +1,46 @@
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+
+#include <glad/glad.h>
+
+namespace BunnyGL {
+
+    Mesh::Mesh(const VertexLayout& layout, const void* vertices, uint32_t vertexCount,
+               const uint32_t* indices, uint32_t indexCount)
+        : Mesh(layout, vertices, vertexCount, static_cast<const void*>(indices), indexCount, IndexFormat::UInt32) {}
+
+    Mesh::Mesh(const VertexLayout& layout, const void* vertices, uint32_t vertexCount,
+               const void* indices, uint32_t indexCount, IndexFormat indexFormat)
+        : m_Layout(layout), m_VertexCount(vertexCount), m_IndexCount(indices ? indexCount : 0), m_IndexFormat(indexFormat) {
+        glGenVertexArrays(1, &m_VertexArray);
+        RenderStateCache::BindVertexArray(m_VertexArray);
+
+        m_VertexBuffer = std::make_unique<Buffer>(BufferType::Vertex, vertices, static_cast<size_t>(vertexCount) * layout.Stride);
+        m_VertexBuffer->Bind();
+        for (uint32_t location = 0; location < layout.Attributes.size(); location++) {
+            const VertexAttribute& attribute = layout.Attributes[location];
+            glVertexAttribPointer(location, static_cast<GLint>(attribute.Components), GL_FLOAT, GL_FALSE,
+                                  static_cast<GLsizei>(layout.Stride), reinterpret_cast<const void*>(static_cast<uintptr_t>(attribute.Offset)));
+            glEnableVertexAttribArray(location);
+        }
+
+        if (m_IndexCount > 0) {
+            m_IndexBuffer = std::make_unique<Buffer>(BufferType::Index, indices, static_cast<size_t>(m_IndexCount) * GetIndexSize(indexFormat));
+            m_IndexBuffer->Bind();
+        }
+    }
+
+    Mesh::~Mesh() {
+        m_IndexBuffer.reset();
+        m_VertexBuffer.reset();
+        if (m_VertexArray != 0) {
+            glDeleteVertexArrays(1, &m_VertexArray);
+            RenderStateCache::Invalidate();
+        }
+    }
+
+    size_t Mesh::GetSizeBytes() const {
+        return (m_VertexBuffer ? m_VertexBuffer->GetSize() : 0) + (m_IndexBuffer ? m_IndexBuffer->GetSize() : 0);
+    }
+
+}
@@ -0,0 +1,259 @@
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Renderer/Shader.hpp>
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstring>
+
+namespace BunnyGL {
+
+    namespace {
+
+        // Never a valid name or enum value, so the first request always goes through
+        constexpr uint32_t Unknown = 0xFFFFFFFFu;
+        constexpr uint8_t UnknownFlag = 0xFF;
+
+        struct BufferRange {
+            uint32_t Buffer = Unknown;
+            uint64_t Offset = 0;
+            uint64_t Size = 0;
+        };
+
+        struct CachedState {
+            uint32_t Program = Unknown;
+            uint32_t VertexArray = Unknown;
+            uint32_t ArrayBuffer = Unknown;
+            uint32_t ElementBuffer = Unknown;
+            uint32_t UniformBuffer = Unknown;
+            BufferRange UniformRanges[RenderStateCache::MaxUniformBindings];
+            uint32_t ActiveTexture = Unknown;
+            uint32_t Textures[RenderStateCache::MaxTextureUnits];
+            uint32_t TextureTargets[RenderStateCache::MaxTextureUnits];
+
+            uint8_t Blend = UnknownFlag;
+            uint8_t DepthTest = UnknownFlag;
+            uint8_t DepthWrite = UnknownFlag;
+            uint8_t DepthCompare = UnknownFlag;
+            uint8_t Cull = UnknownFlag;
+            int Viewport[4] = { -1, -1, -1, -1 };
+            bool ViewportKnown = false;
+            float ClearColor[4] = {};
+            bool ClearColorKnown = false;
+
+            CachedState() {
+                for (uint32_t& texture : Textures) texture = Unknown;
+                for (uint32_t& target : TextureTargets) target = Unknown;
+            }
+        };
+
+        CachedState s_State;
+        RenderStateStats s_Frame;
+        std::atomic<uint64_t> s_LastIssued{0};
+        std::atomic<uint64_t> s_LastSkipped{0};
+
+        // Returns true (and counts the call) if value differs from cached
+        template<typename T>
+        bool Update(T& cached, T value) {
+            if (cached == value) {
+                s_Frame.Skipped++;
+                return false;
+            }
+            cached = value;
+            s_Frame.Issued++;
+            return true;
+        }
+
+        GLenum ToGL(CompareFunction compare) {
+            switch (compare) {
+                case CompareFunction::Never:        return GL_NEVER;
+                case CompareFunction::Less:         return GL_LESS;
+                case CompareFunction::Equal:        return GL_EQUAL;
+                case CompareFunction::LessEqual:    return GL_LEQUAL;
+                case CompareFunction::Greater:      return GL_GREATER;
+                case CompareFunction::NotEqual:     return GL_NOTEQUAL;
+                case CompareFunction::GreaterEqual: return GL_GEQUAL;
+                case CompareFunction::Always:       return GL_ALWAYS;
+            }
+            return GL_LESS;
+        }
+
+        void SetCapability(GLenum capability, bool enabled) {
+            if (enabled) {
+                glEnable(capability);
+            } else {
+                glDisable(capability);
+            }
+        }
+    }
+
+    void RenderStateCache::Invalidate() {
+        s_State = CachedState();
+    }
+
+    void RenderStateCache::BeginFrame() {
+        s_LastIssued.store(s_Frame.Issued, std::memory_order_relaxed);
+        s_LastSkipped.store(s_Frame.Skipped, std::memory_order_relaxed);
+        s_Frame = RenderStateStats();
+    }
+
+    RenderStateStats RenderStateCache::GetFrameStats() {
+        RenderStateStats stats;
+        stats.Issued = s_LastIssued.load(std::memory_order_relaxed);
+        stats.Skipped = s_LastSkipped.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void RenderStateCache::UseProgram(uint32_t program) {
+        if (Update(s_State.Program, program)) {
+            glUseProgram(program);
+        }
+    }
+
+    void RenderStateCache::BindVertexArray(uint32_t vertexArray) {
+        if (Update(s_State.VertexArray, vertexArray)) {
+            glBindVertexArray(vertexArray);
+            // The element buffer binding is part of the VAO
+            s_State.ElementBuffer = Unknown;
+        }
+    }
+
+    void RenderStateCache::BindBuffer(uint32_t target, uint32_t buffer) {
+        uint32_t* cached = nullptr;
+        switch (target) {
+            case GL_ARRAY_BUFFER:           cached = &s_State.ArrayBuffer; break;
+            case GL_ELEMENT_ARRAY_BUFFER:   cached = &s_State.ElementBuffer; break;
+            case GL_UNIFORM_BUFFER:         cached = &s_State.UniformBuffer; break;
+            default:
+                s_Frame.Issued++;
+                glBindBuffer(target, buffer);
+                return;
+        }
+        if (Update(*cached, buffer)) {
+            glBindBuffer(target, buffer);
+        }
+    }
+
+    void RenderStateCache::BindBufferRange(uint32_t binding, uint32_t buffer, uint64_t offset, uint64_t size) {
+        // glBindBufferRange also changes the generic binding
+        s_State.UniformBuffer = Unknown;
+        if (binding >= MaxUniformBindings) {
+            s_Frame.Issued++;
+            glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+            return;
+        }
+
+        BufferRange& cached = s_State.UniformRanges[binding];
+        if (cached.Buffer == buffer && cached.Offset == offset && cached.Size == size) {
+            s_Frame.Skipped++;
+            return;
+        }
+        cached = BufferRange{ buffer, offset, size };
+        s_Frame.Issued++;
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+    }
+
+    void RenderStateCache::BindTexture(uint32_t unit, uint32_t target, uint32_t texture) {
+        if (unit < MaxTextureUnits && s_State.Textures[unit] == texture && s_State.TextureTargets[unit] == target) {
+            s_Frame.Skipped++;
+            return;
+        }
+        if (s_State.ActiveTexture != unit) {
+            s_State.ActiveTexture = unit;
+            s_Frame.Issued++;
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+        if (unit < MaxTextureUnits) {
+            s_State.Textures[unit] = texture;
+            s_State.TextureTargets[unit] = target;
+        }
+        s_Frame.Issued++;
+        glBindTexture(target, texture);
+    }
+
+    void RenderStateCache::SetBlend(BlendMode mode) {
+        uint8_t previous = s_State.Blend;
+        if (!Update(s_State.Blend, static_cast<uint8_t>(mode))) {
+            return;
+        }
+
+        if (mode == BlendMode::None) {
+            glDisable(GL_BLEND);
+            return;
+        }
+        if (previous == UnknownFlag || previous == static_cast<uint8_t>(BlendMode::None)) {
+            glEnable(GL_BLEND);
+        }
+        switch (mode) {
+            case BlendMode::Alpha:          glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break;
+            case BlendMode::Premultiplied:  glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); break;
+            case BlendMode::Additive:       glBlendFunc(GL_SRC_ALPHA, GL_ONE); break;
+            default: break;
+        }
+    }
+
+    void RenderStateCache::SetDepth(bool test, bool write, CompareFunction compare) {
+        if (Update(s_State.DepthTest, static_cast<uint8_t>(test))) {
+            SetCapability(GL_DEPTH_TEST, test);
+        }
+        SetDepthWrite(write);
+        if (Update(s_State.DepthCompare, static_cast<uint8_t>(compare))) {
+            glDepthFunc(ToGL(compare));
+        }
+    }
+
+    void RenderStateCache::SetDepthWrite(bool write) {
+        if (Update(s_State.DepthWrite, static_cast<uint8_t>(write))) {
+            glDepthMask(write ? GL_TRUE : GL_FALSE);
+        }
+    }
+
+    void RenderStateCache::SetCull(CullMode mode) {
+        uint8_t previous = s_State.Cull;
+        if (!Update(s_State.Cull, static_cast<uint8_t>(mode))) {
+            return;
+        }
+
+        if (mode == CullMode::None) {
+            glDisable(GL_CULL_FACE);
+            return;
+        }
+        if (previous == UnknownFlag || previous == static_cast<uint8_t>(CullMode::None)) {
+            glEnable(GL_CULL_FACE);
+        }
+        glCullFace(mode == CullMode::Front ? GL_FRONT : GL_BACK);
+    }
+
+    void RenderStateCache::SetViewport(int x, int y, int width, int height) {
+        int viewport[4] = { x, y, width, height };
+        if (s_State.ViewportKnown && std::memcmp(s_State.Viewport, viewport, sizeof(viewport)) == 0) {
+            s_Frame.Skipped++;
+            return;
+        }
+        std::memcpy(s_State.Viewport, viewport, sizeof(viewport));
+        s_State.ViewportKnown = true;
+        s_Frame.Issued++;
+        glViewport(x, y, width, height);
+    }
+
+    void RenderStateCache::SetClearColor(float r, float g, float b, float a) {
+        float color[4] = { r, g, b, a };
+        if (s_State.ClearColorKnown && std::memcmp(s_State.ClearColor, color, sizeof(color)) == 0) {
+            s_Frame.Skipped++;
+            return;
+        }
+        std::memcpy(s_State.ClearColor, color, sizeof(color));
+        s_State.ClearColorKnown = true;
+        s_Frame.Issued++;
+        glClearColor(r, g, b, a);
+    }
+
+    void RenderStateCache::ApplyPipeline(const PipelineState& pipeline) {
+        const PipelineDescription& description = pipeline.GetDescription();
+        UseProgram(description.Program ? description.Program->GetRendererID() : 0);
+        SetBlend(description.Blend);
+        SetDepth(description.DepthTest, description.DepthWrite, description.DepthCompare);
+        SetCull(description.Cull);
+    }
+
+}
@@ -0,0 +1,91 @@
+#include <BunnyGL/Renderer/RenderThread.hpp>
+#include <BunnyGL/Core/Window.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+namespace BunnyGL {
+
+    RenderThread::RenderThread(Window& window, FrameFunction renderFrame)
+        : m_Window(window), m_RenderFrame(std::move(renderFrame)) {
+
+        // A context can only be current on one thread at a time
+        m_Window.ReleaseContext();
+        m_Thread = std::thread([this]() { ThreadLoop(); });
+
+        BG_INFO("Render thread started");
+    }
+
+    RenderThread::~RenderThread() {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_CV.wait(lock, [this]() { return !m_Pending && !m_Task; });
+            m_Stopping = true;
+        }
+        m_CV.notify_all();
+        m_Thread.join();
+
+        m_Window.MakeContextCurrent();
+        BG_INFO("Render thread stopped");
+    }
+
+    void RenderThread::SubmitFrame(uint32_t frame) {
+        BG_PROFILE_SCOPE("RenderThread::SubmitFrame");
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_CV.wait(lock, [this]() { return !m_Pending && !m_Task; });
+        m_Pending = &m_Lists[m_RecordIndex];
+        m_PendingFrame = frame;
+        // Keeps a capture from being exported before this frame's replay is in
+        Profiler::RetainFrame(frame);
+        m_RecordIndex ^= 1;
+        lock.unlock();
+        m_CV.notify_all();
+    }
+
+    void RenderThread::Execute(const std::function<void()>& task) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_CV.wait(lock, [this]() { return !m_Pending && !m_Task; });
+        m_Task = &task;
+        m_CV.notify_all();
+        m_CV.wait(lock, [this]() { return !m_Task; });
+    }
+
+    void RenderThread::WaitIdle() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_CV.wait(lock, [this]() { return !m_Pending && !m_Task; });
+    }
+
+    void RenderThread::ThreadLoop() {
+        Profiler::SetThreadName("Render");
+        m_Window.MakeContextCurrent();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        for (;;) {
+            m_CV.wait(lock, [this]() { return m_Pending || m_Task || m_Stopping; });
+
+            if (m_Task) {
+                const std::function<void()>* task = m_Task;
+                lock.unlock();
+                (*task)();
+                lock.lock();
+                m_Task = nullptr;
+                m_CV.notify_all();
+            } else if (m_Pending) {
+                const CommandList* list = m_Pending;
+                uint32_t frame = m_PendingFrame;
+                lock.unlock();
+                m_RenderFrame(*list, frame);
+                Profiler::ReleaseFrame(frame);
+                lock.lock();
+                m_Pending = nullptr;
+                m_CV.notify_all();
+            } else {
+                break;
+            }
+        }
+        lock.unlock();
+
+        m_Window.ReleaseContext();
+    }
+
+}
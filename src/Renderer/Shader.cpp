@@ -1,27 +1,53 @@
 #include <BunnyGL/Renderer/Shader.hpp>
-#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Renderer/ShaderCompiler.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Renderer/UniformArena.hpp>
 #include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace BunnyGL {
 
     // Constructor from separate files
-    Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) : m_RendererID(0) {
+    Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines) : m_RendererID(0) {
 
-        // Read shader files
-        std::string vertexSource = FileSystem::ReadFile(vertexPath);
-        std::string fragmentSource = FileSystem::ReadFile(fragmentPath);
+        // Resolve includes and defines
+        PreprocessedShader vertex = ShaderPreprocessor::Process(vertexPath, defines);
+        PreprocessedShader fragment = ShaderPreprocessor::Process(fragmentPath, defines);
 
-        if (vertexSource.empty() || fragmentSource.empty()) {
+        if (!vertex.Success || !fragment.Success) {
             BG_ERROR("Failed to load shader files:", vertexPath," or ", fragmentPath);
             return;
         }
 
-        m_RendererID = CreateShader(vertexSource, fragmentSource);
+        m_RendererID = CreateShader(vertex.Source, fragment.Source);
+        if (m_RendererID != 0) {
+            Reflect();
+        } else {
+            LogSourceFiles(vertex, fragment);
+        }
+    }
+
+    // Compiler messages refer to files by source string number
+    void Shader::LogSourceFiles(const PreprocessedShader& vertex, const PreprocessedShader& fragment) {
+        for (size_t i = 0; i < vertex.Files.size(); ++i) {
+            BG_ERROR("  vertex source ", i, ": ", vertex.Files[i]);
+        }
+        for (size_t i = 0; i < fragment.Files.size(); ++i) {
+            BG_ERROR("  fragment source ", i, ": ", fragment.Files[i]);
+        }
+    }
+
+    // Adopt an already linked program (see ShaderCompiler)
+    Shader::Shader(unsigned int program) : m_RendererID(program) {
+        if (m_RendererID != 0) {
+            Reflect();
+        }
     }
 
     // Destructor
@@ -30,7 +56,10 @@ namespace BunnyGL {
     }
 
     // Move constructor
-    Shader::Shader(Shader&& other) noexcept : m_RendererID(other.m_RendererID), m_UniformLocationCache(std::move(other.m_UniformLocationCache)) {
+    Shader::Shader(Shader&& other) noexcept
+        : m_RendererID(other.m_RendererID), m_Uniforms(std::move(other.m_Uniforms)),
+          m_TypeErrorReported(std::move(other.m_TypeErrorReported)), m_MissingUniforms(std::move(other.m_MissingUniforms)),
+          m_UniformBlocks(std::move(other.m_UniformBlocks)) {
         other.m_RendererID = 0;
     }
 
@@ -42,7 +71,10 @@ namespace BunnyGL {
             }
 
             m_RendererID = other.m_RendererID;
-            m_UniformLocationCache = std::move(other.m_UniformLocationCache);
+            m_Uniforms = std::move(other.m_Uniforms);
+            m_TypeErrorReported = std::move(other.m_TypeErrorReported);
+            m_MissingUniforms = std::move(other.m_MissingUniforms);
+            m_UniformBlocks = std::move(other.m_UniformBlocks);
             other.m_RendererID = 0;
         }
         return *this;
@@ -51,179 +83,305 @@ namespace BunnyGL {
     // Bind shader
     void Shader::Bind() const {
         if (m_RendererID != 0) {
-            glUseProgram(m_RendererID);
+            RenderStateCache::UseProgram(m_RendererID);
         }
     }
 
     // Unbind shader
     void Shader::Unbind() const {
-        glUseProgram(0);
+        RenderStateCache::UseProgram(0);
+    }
+
+    // Create complete shader program
+    unsigned int Shader::CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+        BG_PROFILE_SCOPE("Shader::CreateShader");
+
+        ShaderCompileJob job = ShaderCompiler::Submit(vertexShader, fragmentShader);
+        return ShaderCompiler::Finish(job);
     }
 
-    // Compile individual shader
-    unsigned int Shader::CompileShader(unsigned int type, const std::string& source) {
-        unsigned int shader = glCreateShader(type);
-        if (shader == 0) {
-            BG_FATAL("Failed to create shader object");
-            return 0;
+    namespace {
+        UniformType ToUniformType(GLenum type) {
+            switch (type) {
+                case GL_INT:
+                case GL_BOOL:               return UniformType::Int;
+                case GL_FLOAT:              return UniformType::Float;
+                case GL_FLOAT_VEC2:         return UniformType::Vec2;
+                case GL_FLOAT_VEC3:         return UniformType::Vec3;
+                case GL_FLOAT_VEC4:         return UniformType::Vec4;
+                case GL_FLOAT_MAT3:         return UniformType::Mat3;
+                case GL_FLOAT_MAT4:         return UniformType::Mat4;
+                case GL_SAMPLER_1D:
+                case GL_SAMPLER_2D:
+                case GL_SAMPLER_3D:
+                case GL_SAMPLER_CUBE:
+                case GL_SAMPLER_2D_SHADOW:
+                case GL_SAMPLER_2D_ARRAY:
+                case GL_INT_SAMPLER_2D:
+                case GL_UNSIGNED_INT_SAMPLER_2D: return UniformType::Sampler;
+                default:                    return UniformType::Unknown;
+            }
         }
 
-        const char* src = source.c_str();
-        glShaderSource(shader, 1, &src, nullptr);
-        glCompileShader(shader);
+        const char* ToString(UniformType type) {
+            switch (type) {
+                case UniformType::Int:      return "int";
+                case UniformType::Float:    return "float";
+                case UniformType::Vec2:     return "vec2";
+                case UniformType::Vec3:     return "vec3";
+                case UniformType::Vec4:     return "vec4";
+                case UniformType::Mat3:     return "mat3";
+                case UniformType::Mat4:     return "mat4";
+                case UniformType::Sampler:  return "sampler";
+                default:                    return "unknown";
+            }
+        }
+    }
 
-        // Check compilation status
-        int success;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    // Enumerate active uniforms and uniform blocks once, right after linking
+    void Shader::Reflect() {
+        m_Uniforms.clear();
+        m_UniformBlocks.clear();
+
+        int count = 0;
+        int maxLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+        std::vector<char> name(static_cast<size_t>(std::max(maxLength, 1)));
+        for (int i = 0; i < count; ++i) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+
+            // Members of uniform blocks have no location
+            int location = glGetUniformLocation(m_RendererID, name.data());
+            if (location == -1) {
+                continue;
+            }
 
-        if (!success) {
-            int length;
-            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
-            char* message = new char[length];
-            glGetShaderInfoLog(shader, length, nullptr, message);
+            std::string uniformName(name.data(), static_cast<size_t>(length));
+            if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0) {
+                uniformName.resize(uniformName.size() - 3);
+            }
 
-            BG_ERROR("Failed to compile shader:",message);
-            delete[] message;
-            glDeleteShader(shader);
-            return 0;
+            UniformType uniformType = ToUniformType(type);
+            BG_LOG(Trace, Renderer, "Uniform ", uniformName, " (", ToString(uniformType), ", ", size, ") -> location ", location,
+                   " (shader ID:", m_RendererID, ")");
+            m_Uniforms.push_back({ std::move(uniformName), location, uniformType, size });
         }
 
-        return shader;
+        if (m_Uniforms.size() >= UniformHandle::Invalid) {
+            BG_WARN("Shader ", m_RendererID, " has more uniforms than handles can address");
+            m_Uniforms.resize(UniformHandle::Invalid - 1);
+        }
+        m_TypeErrorReported.assign(m_Uniforms.size(), false);
+
+        int blockCount = 0;
+        int maxBlockNameLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+        name.resize(static_cast<size_t>(std::max(maxBlockNameLength, 1)));
+        for (int i = 0; i < blockCount; ++i) {
+            GLsizei length = 0;
+            GLint size = 0;
+            glGetActiveUniformBlockName(m_RendererID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, name.data());
+            glGetActiveUniformBlockiv(m_RendererID, static_cast<GLuint>(i), GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+
+            UniformBlockInfo block{ std::string(name.data(), static_cast<size_t>(length)), static_cast<uint32_t>(i), static_cast<uint32_t>(size), -1 };
+            int binding = UniformBinding::FromBlockName(block.Name);
+            if (binding >= 0) {
+                glUniformBlockBinding(m_RendererID, block.Index, static_cast<GLuint>(binding));
+                block.Binding = binding;
+            }
+            BG_LOG(Trace, Renderer, "Uniform block ", block.Name, " (", block.Size, " bytes) -> binding ", block.Binding,
+                   " (shader ID:", m_RendererID, ")");
+            m_UniformBlocks.push_back(std::move(block));
+        }
     }
 
-    // Create complete shader program
-    unsigned int Shader::CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+    bool Shader::SetUniformBlockBinding(std::string_view name, uint32_t binding, uint32_t expectedSize) {
+        for (UniformBlockInfo& block : m_UniformBlocks) {
+            if (block.Name != name) {
+                continue;
+            }
+            // std140 rounds a block up to a multiple of 16 bytes; the reported size may or may not include that
+            auto roundUp = [](uint32_t size) { return (size + 15u) & ~15u; };
+            if (expectedSize != 0 && roundUp(expectedSize) != roundUp(block.Size)) {
+                BG_ERROR("Uniform block ", block.Name, " is ", block.Size, " bytes in the shader but ", expectedSize,
+                         " bytes in C++ (shader ID:", m_RendererID, ")");
+                return false;
+            }
+            glUniformBlockBinding(m_RendererID, block.Index, binding);
+            block.Binding = static_cast<int>(binding);
+            return true;
+        }
+
+        BG_WARN("Uniform block ", name, " not found in shader (ID:", m_RendererID, ")");
+        return false;
+    }
 
-        if (vertexShader.empty() || fragmentShader.empty()) {
-            BG_ERROR("Empty shader source provided");
-            return 0;
+    void Shader::ReplaceProgram(unsigned int program) {
+        std::vector<UniformInfo> previousUniforms = std::move(m_Uniforms);
+        std::vector<UniformBlockInfo> previousBlocks = std::move(m_UniformBlocks);
+
+        if (m_RendererID != 0) {
+            glDeleteProgram(m_RendererID);
+        }
+        m_RendererID = program;
+        Reflect();
+
+        // Keep every existing handle pointing at the same name. Uniforms the new
+        // program dropped stay in their slot with location -1 (a no-op to set).
+        std::vector<UniformInfo> uniforms;
+        uniforms.reserve(std::max(previousUniforms.size(), m_Uniforms.size()));
+        for (UniformInfo& previous : previousUniforms) {
+            auto it = std::find_if(m_Uniforms.begin(), m_Uniforms.end(), [&](const UniformInfo& u) { return u.Name == previous.Name; });
+            if (it != m_Uniforms.end()) {
+                uniforms.push_back(*it);
+            } else {
+                previous.Location = -1;
+                uniforms.push_back(std::move(previous));
+            }
         }
-        // Create program
-        unsigned int program = glCreateProgram();
-        if (program == 0) {
-            BG_ERROR("Failed to create shader program");
-            return 0;
+        for (UniformInfo& uniform : m_Uniforms) {
+            auto it = std::find_if(uniforms.begin(), uniforms.end(), [&](const UniformInfo& u) { return u.Name == uniform.Name; });
+            if (it == uniforms.end()) {
+                uniforms.push_back(std::move(uniform));
+            }
+        }
+        m_Uniforms = std::move(uniforms);
+        m_TypeErrorReported.assign(m_Uniforms.size(), false);
+        m_MissingUniforms.clear();
+
+        // Reapply bindings set through SetUniformBlockBinding
+        for (const UniformBlockInfo& previous : previousBlocks) {
+            if (previous.Binding < 0) continue;
+            for (UniformBlockInfo& block : m_UniformBlocks) {
+                if (block.Name == previous.Name && block.Binding != previous.Binding) {
+                    glUniformBlockBinding(m_RendererID, block.Index, static_cast<GLuint>(previous.Binding));
+                    block.Binding = previous.Binding;
+                }
+            }
         }
+    }
 
-        // Compile shaders
-        unsigned int vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-        unsigned int fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+    UniformHandle Shader::GetUniformHandle(std::string_view name) {
+        for (size_t i = 0; i < m_Uniforms.size(); ++i) {
+            if (m_Uniforms[i].Name == name) {
+                return UniformHandle{ static_cast<uint16_t>(i) };
+            }
+        }
 
-        if (vs == 0 || fs == 0) {
-            glDeleteProgram(program);
-            return 0;
+        // Report each unknown name once (it may be a typo, or optimized out)
+        if (std::find(m_MissingUniforms.begin(), m_MissingUniforms.end(), name) == m_MissingUniforms.end()) {
+            m_MissingUniforms.emplace_back(name);
+            BG_WARN("Uniform ", name, " not found in shader (ID:", m_RendererID, ")");
         }
+        return UniformHandle{};
+    }
 
-        // Attach and link
-        glAttachShader(program, vs);
-        glAttachShader(program, fs);
-        glLinkProgram(program);
+    const UniformInfo* Shader::Resolve(UniformHandle handle, UniformType type) {
+        if (handle.Index >= m_Uniforms.size()) {
+            return nullptr;
+        }
 
-        // Check linking status
-        int success;
-        glGetProgramiv(program, GL_LINK_STATUS, &success);
-        if (!success) {
-            int length;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
-            char* message = new char[length];
-            glGetProgramInfoLog(program, length, nullptr, message);
-            BG_ERROR("Failed to link shader program:", message);
-            delete[] message;
-            glDeleteShader(vs);
-            glDeleteShader(fs);
-            glDeleteProgram(program);
-            return 0;
+        const UniformInfo& uniform = m_Uniforms[handle.Index];
+        bool compatible = uniform.Type == type || (type == UniformType::Int && uniform.Type == UniformType::Sampler);
+        if (!compatible) {
+            if (!m_TypeErrorReported[handle.Index]) {
+                m_TypeErrorReported[handle.Index] = true;
+                BG_ERROR("Uniform ", uniform.Name, " is ", ToString(uniform.Type), ", not ", ToString(type),
+                         " (shader ID:", m_RendererID, ")");
+            }
+            return nullptr;
         }
+        return &uniform;
+    }
 
-        // Cleanup individual shaders
-        glDetachShader(program, vs);
-        glDetachShader(program, fs);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+    // Typed setters
+    void Shader::SetUniform(UniformHandle handle, int value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Int)) {
+            glUniform1i(uniform->Location, value);
+        }
+    }
 
-        return program;
+    void Shader::SetUniform(UniformHandle handle, float value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Float)) {
+            glUniform1f(uniform->Location, value);
+        }
     }
 
-    // Get uniform location with caching
-    int Shader::GetUniformLocation(const std::string& name) {
-        // Check cache first
-        auto it = m_UniformLocationCache.find(name);
-        if (it != m_UniformLocationCache.end()) {
-            return it->second;
+    void Shader::SetUniform(UniformHandle handle, const glm::vec2& value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Vec2)) {
+            glUniform2f(uniform->Location, value.x, value.y);
         }
+    }
 
-        // Get from OpenGL
-        int location = glGetUniformLocation(m_RendererID, name.c_str());
+    void Shader::SetUniform(UniformHandle handle, const glm::vec3& value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Vec3)) {
+            glUniform3f(uniform->Location, value.x, value.y, value.z);
+        }
+    }
 
-        // Cache result (even if -1 to avoid repeated lookups)
-        m_UniformLocationCache[name] = location;
+    void Shader::SetUniform(UniformHandle handle, const glm::vec4& value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Vec4)) {
+            glUniform4f(uniform->Location, value.x, value.y, value.z, value.w);
+        }
+    }
 
-        if (location == -1) {
-            BG_WARN("Uniform ",name," not found in shader (ID:",m_RendererID,")");
+    void Shader::SetUniform(UniformHandle handle, const glm::mat3& value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Mat3)) {
+            glUniformMatrix3fv(uniform->Location, 1, GL_FALSE, &value[0][0]);
         }
+    }
 
-        return location;
+    void Shader::SetUniform(UniformHandle handle, const glm::mat4& value) {
+        if (const UniformInfo* uniform = Resolve(handle, UniformType::Mat4)) {
+            glUniformMatrix4fv(uniform->Location, 1, GL_FALSE, &value[0][0]);
+        }
     }
 
-    // Uniform setters (with location check)
+    // Name-based setters
     void Shader::SetUniform1i(const std::string& name, int value) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform1i(location, value);
-        }
+        SetUniform(GetUniformHandle(name), value);
     }
 
     void Shader::SetUniform1f(const std::string& name, float value) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform1f(location, value);
-        }
+        SetUniform(GetUniformHandle(name), value);
     }
 
     void Shader::SetUniform2f(const std::string& name, float v0, float v1) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform2f(location, v0, v1);
-        }
+        SetUniform(GetUniformHandle(name), glm::vec2(v0, v1));
     }
 
     void Shader::SetUniform3f(const std::string& name, float v0, float v1, float v2) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform3f(location, v0, v1, v2);
-        }
+        SetUniform(GetUniformHandle(name), glm::vec3(v0, v1, v2));
     }
 
     void Shader::SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniform4f(location, v0, v1, v2, v3);
-        }
+        SetUniform(GetUniformHandle(name), glm::vec4(v0, v1, v2, v3));
     }
 
     void Shader::SetUniformMat3f(const std::string& name, const glm::mat3& matrix) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniformMatrix3fv(location, 1, GL_FALSE, &matrix[0][0]);
-        }
+        SetUniform(GetUniformHandle(name), matrix);
     }
 
     void Shader::SetUniformMat4f(const std::string& name, const glm::mat4& matrix) {
-        int location = GetUniformLocation(name);
-        if (location != -1) {
-            glUniformMatrix4fv(location, 1, GL_FALSE, &matrix[0][0]);
-        }
+        SetUniform(GetUniformHandle(name), matrix);
     }
 
     void Shader::SetUniformVec2(const std::string& name, const glm::vec2& value) {
-        SetUniform2f(name, value.x, value.y);
+        SetUniform(GetUniformHandle(name), value);
     }
 
     void Shader::SetUniformVec3(const std::string& name, const glm::vec3& value) {
-        SetUniform3f(name, value.x, value.y, value.z);
+        SetUniform(GetUniformHandle(name), value);
     }
 
     void Shader::SetUniformVec4(const std::string& name, const glm::vec4& value) {
-        SetUniform4f(name, value.x, value.y, value.z, value.w);
+        SetUniform(GetUniformHandle(name), value);
     }
 }
\ No newline at end of file
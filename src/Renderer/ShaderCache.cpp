@@ -0,0 +1,284 @@
+#include <BunnyGL/Renderer/ShaderCache.hpp>
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Core/Hash.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace BunnyGL {
+
+    namespace {
+
+        namespace fs = std::filesystem;
+
+        constexpr char EntryMagic[4] = { 'B', 'G', 'P', 'B' };
+        constexpr uint32_t EntryVersion = 1;
+
+        struct EntryHeader {
+            char Magic[4];
+            uint32_t Version;
+            uint64_t Key;
+            uint64_t DriverHash;    // Guards against a stale file surviving a key collision
+            uint32_t Format;        // GLenum binary format
+            uint32_t Size;          // Bytes of binary after the header
+        };
+
+        struct ShaderCacheState {
+            bool Enabled = false;
+            fs::path Directory;
+            uint64_t MaxBytes = 0;
+            uint64_t DriverHash = 0;
+            ShaderCacheStats Stats;
+        };
+
+        ShaderCacheState s_State;
+        std::mutex s_Mutex;
+
+        std::string GLString(GLenum name) {
+            const GLubyte* value = glGetString(name);
+            return value ? reinterpret_cast<const char*>(value) : "";
+        }
+
+        fs::path EntryPath(uint64_t key) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+            return s_State.Directory / name;
+        }
+
+        void RemoveEntry(const fs::path& path) {
+            std::error_code ec;
+            uint64_t size = fs::file_size(path, ec);
+            if (fs::remove(path, ec) && !ec) {
+                s_State.Stats.BytesOnDisk -= std::min(s_State.Stats.BytesOnDisk, size);
+            }
+        }
+
+        // Deletes least recently used entries until the cache fits in MaxBytes
+        void EnforceSizeCap() {
+            if (s_State.Stats.BytesOnDisk <= s_State.MaxBytes) {
+                return;
+            }
+
+            struct Entry {
+                fs::path Path;
+                fs::file_time_type LastUsed;
+                uint64_t Size;
+            };
+            std::vector<Entry> entries;
+            std::error_code ec;
+            for (const fs::directory_entry& file : fs::directory_iterator(s_State.Directory, ec)) {
+                if (file.path().extension() != ".bin") continue;
+                std::error_code fileEc;
+                Entry entry{ file.path(), file.last_write_time(fileEc), file.file_size(fileEc) };
+                if (!fileEc) entries.push_back(std::move(entry));
+            }
+            std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.LastUsed < b.LastUsed; });
+
+            uint64_t total = 0;
+            for (const Entry& entry : entries) total += entry.Size;
+
+            for (const Entry& entry : entries) {
+                if (total <= s_State.MaxBytes) break;
+                if (fs::remove(entry.Path, ec)) {
+                    total -= entry.Size;
+                    s_State.Stats.Evictions++;
+                }
+            }
+            s_State.Stats.BytesOnDisk = total;
+        }
+    }
+
+    void ShaderCache::Init(const std::string& directory, uint64_t maxBytes) {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_State = ShaderCacheState();
+
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (directory.empty() || formats <= 0) {
+            BG_LOG(Info, Renderer, "Shader cache disabled", formats <= 0 ? " (driver has no program binary formats)" : "");
+            return;
+        }
+
+        std::error_code ec;
+        fs::create_directories(directory, ec);
+        if (ec) {
+            BG_WARN("Shader cache disabled: cannot create ", directory, ": ", ec.message());
+            return;
+        }
+
+        s_State.Directory = directory;
+        s_State.MaxBytes = maxBytes;
+        uint64_t driver = Hash64(GLString(GL_VENDOR));
+        driver = Hash64(GLString(GL_RENDERER), driver);
+        s_State.DriverHash = Hash64(GLString(GL_VERSION), driver);
+        s_State.Enabled = true;
+
+        for (const fs::directory_entry& file : fs::directory_iterator(s_State.Directory, ec)) {
+            std::error_code fileEc;
+            if (file.path().extension() == ".bin") s_State.Stats.BytesOnDisk += file.file_size(fileEc);
+        }
+        EnforceSizeCap();
+
+        BG_LOG(Info, Renderer, "Shader cache: ", directory, " (", s_State.Stats.BytesOnDisk / 1024, " KB of ",
+               maxBytes / 1024, " KB)");
+    }
+
+    void ShaderCache::Shutdown() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_State.Enabled) {
+            const ShaderCacheStats& stats = s_State.Stats;
+            BG_LOG(Info, Renderer, "Shader cache: ", stats.Hits, " hits, ", stats.Misses, " misses, ", stats.Rejected,
+                   " rejected, ", stats.Stores, " stored, ", stats.Evictions, " evicted");
+        }
+        s_State = ShaderCacheState();
+    }
+
+    bool ShaderCache::IsEnabled() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return s_State.Enabled;
+    }
+
+    uint64_t ShaderCache::ComputeKey(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines) {
+        // Lengths are mixed in so moving text between stages changes the key
+        uint64_t hash = Hash64Seed;
+        for (std::string_view part : { vertexSource, fragmentSource, defines }) {
+            uint64_t length = part.size();
+            hash = Hash64Of(length, hash);
+            hash = Hash64(part, hash);
+        }
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return Hash64Of(s_State.DriverHash, hash);
+    }
+
+    unsigned int ShaderCache::Load(uint64_t key) {
+        BG_PROFILE_SCOPE("ShaderCache::Load");
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (!s_State.Enabled) {
+            return 0;
+        }
+
+        fs::path path = EntryPath(key);
+        // The binary goes to the driver straight out of the mapping
+        MappedFile file;
+        if (!file.Open(path.string())) {
+            s_State.Stats.Misses++;
+            return 0;
+        }
+
+        EntryHeader header{};
+        bool valid = file.GetSize() >= sizeof(header);
+        if (valid) {
+            std::memcpy(&header, file.GetData(), sizeof(header));
+            valid = std::equal(header.Magic, header.Magic + 4, EntryMagic) && header.Version == EntryVersion &&
+                    header.Key == key && header.DriverHash == s_State.DriverHash && header.Size > 0 &&
+                    file.GetSize() - sizeof(header) >= header.Size;
+        }
+
+        GLuint program = 0;
+        if (valid) {
+            program = glCreateProgram();
+            glProgramBinary(program, header.Format, file.GetData() + sizeof(header), static_cast<GLsizei>(header.Size));
+            GLint linked = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &linked);
+            if (!linked) {
+                glDeleteProgram(program);
+                program = 0;
+            }
+        }
+        file.Close();
+
+        if (program == 0) {
+            BG_LOG(Debug, Renderer, "Shader cache: discarding unusable entry ", path.filename().string());
+            RemoveEntry(path);
+            s_State.Stats.Rejected++;
+            return 0;
+        }
+
+        // Mark as recently used for eviction
+        std::error_code ec;
+        fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        s_State.Stats.Hits++;
+        return program;
+    }
+
+    void ShaderCache::Store(uint64_t key, unsigned int program) {
+        BG_PROFILE_SCOPE("ShaderCache::Store");
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (!s_State.Enabled || program == 0) {
+            return;
+        }
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) {
+            return;
+        }
+
+        std::vector<char> binary(static_cast<size_t>(length));
+        GLenum format = 0;
+        GLsizei written = 0;
+        glGetProgramBinary(program, length, &written, &format, binary.data());
+        if (written <= 0) {
+            return;
+        }
+
+        EntryHeader header{};
+        std::copy(EntryMagic, EntryMagic + 4, header.Magic);
+        header.Version = EntryVersion;
+        header.Key = key;
+        header.DriverHash = s_State.DriverHash;
+        header.Format = format;
+        header.Size = static_cast<uint32_t>(written);
+
+        // Write to a temporary name first so a crash never leaves a truncated entry
+        fs::path path = EntryPath(key);
+        fs::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(binary.data(), written);
+            if (!file.good()) {
+                BG_WARN("Shader cache: failed to write ", temporary.string());
+                std::error_code ec;
+                fs::remove(temporary, ec);
+                return;
+            }
+        }
+
+        std::error_code ec;
+        RemoveEntry(path);
+        fs::rename(temporary, path, ec);
+        if (ec) {
+            fs::remove(temporary, ec);
+            return;
+        }
+
+        s_State.Stats.Stores++;
+        s_State.Stats.BytesOnDisk += sizeof(header) + static_cast<uint64_t>(written);
+        EnforceSizeCap();
+    }
+
+    void ShaderCache::PrepareProgram(unsigned int program) {
+        if (IsEnabled()) {
+            glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+    }
+
+    ShaderCacheStats ShaderCache::GetStats() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return s_State.Stats;
+    }
+
+}
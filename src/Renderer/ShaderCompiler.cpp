@@ -0,0 +1,178 @@
+#include <BunnyGL/Renderer/ShaderCompiler.hpp>
+#include <BunnyGL/Renderer/ShaderCache.hpp>
+#include <BunnyGL/Core/Window.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <vector>
+
+// GL_KHR_parallel_shader_compile (not in the generated loader, which is core only)
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
+namespace BunnyGL {
+
+    namespace {
+
+        using MaxShaderCompilerThreadsProc = void (APIENTRYP)(GLuint count);
+
+        bool s_ParallelCompile = false;
+
+        bool HasExtension(const char* name) {
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            for (GLint i = 0; i < count; ++i) {
+                const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+                if (extension && std::strcmp(extension, name) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Issues the compile without waiting for it
+        GLuint SubmitStage(GLenum type, const std::string& source) {
+            GLuint shader = glCreateShader(type);
+            if (shader == 0) {
+                BG_FATAL("Failed to create shader object");
+                return 0;
+            }
+            const char* src = source.c_str();
+            glShaderSource(shader, 1, &src, nullptr);
+            glCompileShader(shader);
+            return shader;
+        }
+
+        bool CheckStage(GLuint shader, const char* stage) {
+            GLint success = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+            if (success) {
+                return true;
+            }
+
+            GLint length = 0;
+            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+            std::vector<char> message(static_cast<size_t>(length > 0 ? length : 1), '\0');
+            glGetShaderInfoLog(shader, static_cast<GLsizei>(message.size()), nullptr, message.data());
+            BG_ERROR("Failed to compile ", stage, " shader:", message.data());
+            return false;
+        }
+
+        void Release(ShaderCompileJob& job) {
+            if (job.Vertex) glDeleteShader(job.Vertex);
+            if (job.Fragment) glDeleteShader(job.Fragment);
+            job = ShaderCompileJob();
+        }
+    }
+
+    void ShaderCompiler::Init(const Window& window) {
+        s_ParallelCompile = false;
+        if (!HasExtension("GL_KHR_parallel_shader_compile")) {
+            BG_LOG(Info, Renderer, "GL_KHR_parallel_shader_compile not available; shader batches finish one program at a time");
+            return;
+        }
+
+        auto maxThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(window.GetProcAddress("glMaxShaderCompilerThreadsKHR"));
+        if (maxThreads) {
+            // Let the driver pick how many threads to use
+            maxThreads(0xFFFFFFFFu);
+        }
+        s_ParallelCompile = true;
+        BG_LOG(Info, Renderer, "Parallel shader compilation enabled (GL_KHR_parallel_shader_compile)");
+    }
+
+    bool ShaderCompiler::HasParallelCompile() {
+        return s_ParallelCompile;
+    }
+
+    ShaderCompileJob ShaderCompiler::Submit(const std::string& vertexSource, const std::string& fragmentSource) {
+        BG_PROFILE_SCOPE("ShaderCompiler::Submit");
+
+        ShaderCompileJob job;
+        if (vertexSource.empty() || fragmentSource.empty()) {
+            BG_ERROR("Empty shader source provided");
+            return job;
+        }
+
+        // A cached binary skips both compile and link
+        job.CacheKey = ShaderCache::ComputeKey(vertexSource, fragmentSource);
+        if (GLuint cached = ShaderCache::Load(job.CacheKey)) {
+            job.Program = cached;
+            job.FromCache = true;
+            return job;
+        }
+
+        job.Program = glCreateProgram();
+        if (job.Program == 0) {
+            BG_ERROR("Failed to create shader program");
+            return job;
+        }
+
+        job.Vertex = SubmitStage(GL_VERTEX_SHADER, vertexSource);
+        job.Fragment = SubmitStage(GL_FRAGMENT_SHADER, fragmentSource);
+
+        // Linking a program with failed stages just fails the link; the
+        // stage logs are checked in Finish
+        glAttachShader(job.Program, job.Vertex);
+        glAttachShader(job.Program, job.Fragment);
+        ShaderCache::PrepareProgram(job.Program);
+        glLinkProgram(job.Program);
+        return job;
+    }
+
+    bool ShaderCompiler::IsComplete(const ShaderCompileJob& job) {
+        if (!s_ParallelCompile || !job.IsValid() || job.FromCache) {
+            return true;
+        }
+        GLint complete = GL_FALSE;
+        glGetProgramiv(job.Program, GL_COMPLETION_STATUS_KHR, &complete);
+        return complete == GL_TRUE;
+    }
+
+    unsigned int ShaderCompiler::Finish(ShaderCompileJob& job) {
+        BG_PROFILE_SCOPE("ShaderCompiler::Finish");
+
+        if (!job.IsValid()) {
+            Release(job);
+            return 0;
+        }
+        if (job.FromCache) {
+            GLuint program = job.Program;
+            job = ShaderCompileJob();
+            return program;
+        }
+
+        GLuint program = job.Program;
+        GLint success = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            // Prefer the stage log; the link log only repeats that a stage failed
+            bool stagesCompiled = CheckStage(job.Vertex, "vertex") & CheckStage(job.Fragment, "fragment");
+            if (stagesCompiled) {
+                GLint length = 0;
+                glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+                std::vector<char> message(static_cast<size_t>(length > 0 ? length : 1), '\0');
+                glGetProgramInfoLog(program, static_cast<GLsizei>(message.size()), nullptr, message.data());
+                BG_ERROR("Failed to link shader program:", message.data());
+            }
+            glDeleteProgram(program);
+            Release(job);
+            return 0;
+        }
+
+        glDetachShader(program, job.Vertex);
+        glDetachShader(program, job.Fragment);
+        ShaderCache::Store(job.CacheKey, program);
+        Release(job);
+        return program;
+    }
+
+    void ShaderCompiler::Cancel(ShaderCompileJob& job) {
+        if (job.Program) glDeleteProgram(job.Program);
+        Release(job);
+    }
+
+}
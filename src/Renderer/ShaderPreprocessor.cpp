@@ -0,0 +1,205 @@
+#include <BunnyGL/Renderer/ShaderPreprocessor.hpp>
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Core/Hash.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <unordered_set>
+
+namespace BunnyGL {
+
+    namespace {
+
+        namespace fs = std::filesystem;
+
+        std::vector<std::string> s_IncludeDirectories;
+        std::mutex s_IncludeMutex;
+
+        struct ExpandContext {
+            ShaderDefines Defines;                  // Sorted by name, duplicates removed
+            std::vector<std::string> Files;
+            std::unordered_set<std::string> Once;   // Files that had #pragma once
+            std::vector<std::string> Stack;         // For include cycles
+            std::vector<std::string> IncludeDirectories;
+            std::string Output;
+            bool VersionSeen = false;
+        };
+
+        std::string Normalize(const fs::path& path) {
+            return path.lexically_normal().generic_string();
+        }
+
+        bool StartsWithDirective(const std::string& line, const char* directive, size_t& rest) {
+            size_t i = line.find_first_not_of(" \t");
+            if (i == std::string::npos || line[i] != '#') return false;
+            i = line.find_first_not_of(" \t", i + 1);
+            size_t length = std::char_traits<char>::length(directive);
+            if (i == std::string::npos || line.compare(i, length, directive) != 0) return false;
+            rest = i + length;
+            // Whole word only (#include vs #includes)
+            return rest == line.size() || line[rest] == ' ' || line[rest] == '\t' || line[rest] == '"' || line[rest] == '<';
+        }
+
+        void AppendLineDirective(ExpandContext& context, size_t line, size_t file) {
+            context.Output += "#line " + std::to_string(line) + " " + std::to_string(file) + "\n";
+        }
+
+        std::string DefineBlock(const ShaderDefines& defines) {
+            std::string block;
+            for (const ShaderDefine& define : defines) {
+                block += "#define " + define.Name;
+                if (!define.Value.empty()) block += " " + define.Value;
+                block += "\n";
+            }
+            return block;
+        }
+
+        std::string ResolveInclude(const ExpandContext& context, const fs::path& includingFile, const std::string& name) {
+            fs::path candidate = includingFile.parent_path() / name;
+            if (FileSystem::FileExists(candidate.string())) {
+                return Normalize(candidate);
+            }
+            for (const std::string& directory : context.IncludeDirectories) {
+                candidate = fs::path(directory) / name;
+                if (FileSystem::FileExists(candidate.string())) {
+                    return Normalize(candidate);
+                }
+            }
+            return {};
+        }
+
+        bool Expand(ExpandContext& context, const std::string& path, bool root) {
+            if (std::find(context.Stack.begin(), context.Stack.end(), path) != context.Stack.end()) {
+                BG_ERROR("Shader include cycle: ", path, " includes itself (via ", context.Stack.back(), ")");
+                return false;
+            }
+
+            // Read rather than mapped: hot reload means these files get rewritten
+            // in place, and truncating a mapped file faults its readers
+            std::string source;
+            if (!FileSystem::ReadInto(path, source)) {
+                BG_ERROR("Shader source not found: ", path);
+                return false;
+            }
+
+            size_t fileIndex = context.Files.size();
+            context.Files.push_back(path);
+            context.Stack.push_back(path);
+            if (!root) {
+                AppendLineDirective(context, 1, fileIndex);
+            }
+
+            size_t lineNumber = 0;
+            size_t start = 0;
+            while (start < source.size()) {
+                size_t end = source.find('\n', start);
+                if (end == std::string::npos) end = source.size();
+                std::string line = source.substr(start, end - start);
+                start = end + 1;
+                ++lineNumber;
+
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+
+                size_t rest = 0;
+                if (StartsWithDirective(line, "version", rest)) {
+                    if (!root || context.VersionSeen) {
+                        BG_ERROR("#version in ", path, ":", lineNumber, " is only allowed at the top of the main shader file");
+                        return false;
+                    }
+                    context.Output += line + "\n";
+                    context.Output += DefineBlock(context.Defines);
+                    AppendLineDirective(context, lineNumber + 1, fileIndex);
+                    context.VersionSeen = true;
+                    continue;
+                }
+
+                if (StartsWithDirective(line, "pragma", rest) && line.find("once", rest) != std::string::npos) {
+                    context.Once.insert(path);
+                    context.Output += "\n";
+                    continue;
+                }
+
+                if (StartsWithDirective(line, "include", rest)) {
+                    size_t open = line.find('"', rest);
+                    size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+                    if (close == std::string::npos) {
+                        BG_ERROR("Malformed #include in ", path, ":", lineNumber, " (expected #include \"file\")");
+                        return false;
+                    }
+
+                    std::string name = line.substr(open + 1, close - open - 1);
+                    std::string resolved = ResolveInclude(context, path, name);
+                    if (resolved.empty()) {
+                        BG_ERROR("Cannot find \"", name, "\" included from ", path, ":", lineNumber);
+                        return false;
+                    }
+                    if (context.Once.count(resolved) == 0) {
+                        if (!Expand(context, resolved, false)) {
+                            return false;
+                        }
+                        AppendLineDirective(context, lineNumber + 1, fileIndex);
+                    } else {
+                        context.Output += "\n";
+                    }
+                    continue;
+                }
+
+                context.Output += line + "\n";
+            }
+
+            context.Stack.pop_back();
+            return true;
+        }
+    }
+
+    PreprocessedShader ShaderPreprocessor::Process(const std::string& path, const ShaderDefines& defines) {
+        BG_PROFILE_SCOPE("ShaderPreprocessor::Process");
+
+        ExpandContext context;
+        {
+            std::lock_guard<std::mutex> lock(s_IncludeMutex);
+            context.IncludeDirectories = s_IncludeDirectories;
+        }
+
+        // Canonical define order, so {A, B} and {B, A} give the same variant; later duplicates win
+        for (const ShaderDefine& define : defines) {
+            auto it = std::find_if(context.Defines.begin(), context.Defines.end(),
+                [&](const ShaderDefine& existing) { return existing.Name == define.Name; });
+            if (it != context.Defines.end()) {
+                it->Value = define.Value;
+            } else {
+                context.Defines.push_back(define);
+            }
+        }
+        std::sort(context.Defines.begin(), context.Defines.end(),
+            [](const ShaderDefine& a, const ShaderDefine& b) { return a.Name < b.Name; });
+
+        PreprocessedShader result;
+        std::string root = Normalize(path);
+        if (!Expand(context, root, true)) {
+            result.Files = std::move(context.Files);
+            return result;
+        }
+
+        if (!context.VersionSeen) {
+            context.Output = DefineBlock(context.Defines) + "#line 1 0\n" + context.Output;
+        }
+
+        result.Source = std::move(context.Output);
+        result.Files = std::move(context.Files);
+        result.Hash = Hash64(result.Source);
+        result.Success = true;
+        return result;
+    }
+
+    void ShaderPreprocessor::AddIncludeDirectory(const std::string& directory) {
+        std::lock_guard<std::mutex> lock(s_IncludeMutex);
+        if (std::find(s_IncludeDirectories.begin(), s_IncludeDirectories.end(), directory) == s_IncludeDirectories.end()) {
+            s_IncludeDirectories.push_back(directory);
+        }
+    }
+
+}
@@ -0,0 +1,120 @@
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+
+#include <glad/glad.h>
+
+namespace BunnyGL {
+
+    namespace {
+        struct FormatInfo {
+            GLenum InternalFormat;
+            GLenum Format;
+        };
+
+        FormatInfo ToGL(TextureFormat format) {
+            switch (format) {
+                case TextureFormat::R8:     return { GL_R8, GL_RED };
+                case TextureFormat::RG8:    return { GL_RG8, GL_RG };
+                case TextureFormat::RGB8:   return { GL_RGB8, GL_RGB };
+                case TextureFormat::RGBA8:  return { GL_RGBA8, GL_RGBA };
+            }
+            return { GL_RGBA8, GL_RGBA };
+        }
+    }
+
+    Texture2D::Texture2D(const TextureSpecification& specification, const void* pixels)
+        : m_Specification(specification) {
+        CreateTexture();
+
+        FormatInfo format = ToGL(specification.Format);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, format.InternalFormat, static_cast<GLsizei>(specification.Width),
+                     static_cast<GLsizei>(specification.Height), 0, format.Format, GL_UNSIGNED_BYTE, pixels);
+        if (pixels && specification.Mipmaps) {
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
+    }
+
+    Texture2D::Texture2D(const TextureSpecification& specification, const void* const* levels, uint32_t levelCount)
+        : m_Specification(specification) {
+        m_Specification.Mipmaps = levelCount > 1;
+        CreateTexture();
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount > 0 ? levelCount - 1 : 0));
+
+        FormatInfo format = ToGL(specification.Format);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        uint32_t width = specification.Width;
+        uint32_t height = specification.Height;
+        for (uint32_t level = 0; level < levelCount; level++) {
+            glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format.InternalFormat, static_cast<GLsizei>(width),
+                         static_cast<GLsizei>(height), 0, format.Format, GL_UNSIGNED_BYTE, levels[level]);
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+    }
+
+    void Texture2D::CreateTexture() {
+        glGenTextures(1, &m_RendererID);
+        RenderStateCache::BindTexture(0, GL_TEXTURE_2D, m_RendererID);
+
+        GLint minFilter = m_Specification.Linear ? GL_LINEAR : GL_NEAREST;
+        if (m_Specification.Mipmaps) {
+            minFilter = m_Specification.Linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+        }
+        GLint wrap = m_Specification.Repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_Specification.Linear ? GL_LINEAR : GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+    }
+
+    Texture2D::~Texture2D() {
+        if (m_RendererID != 0) {
+            glDeleteTextures(1, &m_RendererID);
+            // The name can be reused by the next glGenTextures
+            RenderStateCache::Invalidate();
+        }
+    }
+
+    void Texture2D::SetData(const void* pixels) {
+        RenderStateCache::BindTexture(0, GL_TEXTURE_2D, m_RendererID);
+        FormatInfo format = ToGL(m_Specification.Format);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(m_Specification.Width),
+                        static_cast<GLsizei>(m_Specification.Height), format.Format, GL_UNSIGNED_BYTE, pixels);
+        if (m_Specification.Mipmaps) {
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
+    }
+
+    void Texture2D::Bind(uint32_t unit) const {
+        RenderStateCache::BindTexture(unit, GL_TEXTURE_2D, m_RendererID);
+    }
+
+    size_t Texture2D::GetSizeBytes() const {
+        size_t base = static_cast<size_t>(m_Specification.Width) * m_Specification.Height * GetBytesPerPixel(m_Specification.Format);
+        // A full mip chain adds a third
+        return m_Specification.Mipmaps ? base + base / 3 : base;
+    }
+
+    uint32_t Texture2D::GetBytesPerPixel(TextureFormat format) {
+        switch (format) {
+            case TextureFormat::R8:     return 1;
+            case TextureFormat::RG8:    return 2;
+            case TextureFormat::RGB8:   return 3;
+            case TextureFormat::RGBA8:  return 4;
+        }
+        return 4;
+    }
+
+    uint32_t Texture2D::GetMipCount(uint32_t width, uint32_t height) {
+        uint32_t levels = 1;
+        while (width > 1 || height > 1) {
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+            levels++;
+        }
+        return levels;
+    }
+
+}
@@ -0,0 +1,138 @@
+#include <BunnyGL/Renderer/UniformArena.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstring>
+
+namespace BunnyGL {
+
+    namespace {
+
+        struct UniformArenaState {
+            bool Initialized = false;
+            GLuint Buffer = 0;
+            uint32_t RegionSize = 0;
+            uint32_t CurrentRegion = 0;
+            bool RegionWritten = false;
+            GLsync Fences[UniformArena::FramesInFlight] = {};
+        };
+
+        UniformArenaState s_State;
+        std::atomic<uint32_t> s_OffsetAlignment{256};
+
+        void CreateBuffer(uint32_t regionSize) {
+            s_State.RegionSize = regionSize;
+            glGenBuffers(1, &s_State.Buffer);
+            RenderStateCache::BindBuffer(GL_UNIFORM_BUFFER, s_State.Buffer);
+            glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(regionSize) * UniformArena::FramesInFlight, nullptr, GL_DYNAMIC_DRAW);
+        }
+
+        void WaitForRegion(uint32_t region) {
+            GLsync& fence = s_State.Fences[region];
+            if (!fence) {
+                return;
+            }
+            // Normally signalled long ago; only blocks if the GPU is FramesInFlight frames behind
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            while (result == GL_TIMEOUT_EXPIRED) {
+                BG_PROFILE_SCOPE("UniformArena::WaitForRegion");
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    void UniformArena::Init(uint32_t bytesPerFrame) {
+        if (s_State.Initialized) {
+            return;
+        }
+
+        GLint alignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        s_OffsetAlignment.store(alignment > 0 ? static_cast<uint32_t>(alignment) : 256u, std::memory_order_relaxed);
+
+        uint32_t align = GetOffsetAlignment();
+        CreateBuffer((bytesPerFrame + align - 1) / align * align);
+        s_State.Initialized = true;
+
+        BG_LOG(Info, Renderer, "Uniform arena: ", FramesInFlight, " x ", s_State.RegionSize / 1024, " KB, offset alignment ", align);
+    }
+
+    void UniformArena::Shutdown() {
+        if (!s_State.Initialized) {
+            return;
+        }
+        for (GLsync& fence : s_State.Fences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+        glDeleteBuffers(1, &s_State.Buffer);
+        RenderStateCache::Invalidate();
+        s_State = UniformArenaState();
+    }
+
+    uint32_t UniformArena::GetOffsetAlignment() {
+        return s_OffsetAlignment.load(std::memory_order_relaxed);
+    }
+
+    uint32_t UniformArena::Upload(const void* data, uint32_t size) {
+        BG_PROFILE_SCOPE("UniformArena::Upload");
+
+        if (!s_State.Initialized) {
+            Init();
+        }
+
+        if (size > s_State.RegionSize) {
+            // Regions are all the same size, so the whole buffer is replaced;
+            // the old one stays alive in the driver until the GPU is done with it
+            uint32_t regionSize = s_State.RegionSize;
+            while (regionSize < size) regionSize *= 2;
+            BG_LOG(Warn, Renderer, "Uniform arena: ", size, " bytes in one frame, growing regions to ", regionSize / 1024, " KB");
+
+            for (GLsync& fence : s_State.Fences) {
+                if (fence) glDeleteSync(fence);
+                fence = nullptr;
+            }
+            glDeleteBuffers(1, &s_State.Buffer);
+            // Deleting a bound buffer resets its bindings behind the cache's back
+            RenderStateCache::Invalidate();
+            CreateBuffer(regionSize);
+        }
+
+        s_State.CurrentRegion = (s_State.CurrentRegion + 1) % FramesInFlight;
+        WaitForRegion(s_State.CurrentRegion);
+
+        uint32_t base = s_State.CurrentRegion * s_State.RegionSize;
+        RenderStateCache::BindBuffer(GL_UNIFORM_BUFFER, s_State.Buffer);
+        // The fence already guarantees the region is idle, so skip the driver's own sync
+        void* destination = glMapBufferRange(GL_UNIFORM_BUFFER, base, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (destination) {
+            std::memcpy(destination, data, size);
+            glUnmapBuffer(GL_UNIFORM_BUFFER);
+        } else {
+            glBufferSubData(GL_UNIFORM_BUFFER, base, size, data);
+        }
+
+        s_State.RegionWritten = true;
+        return base;
+    }
+
+    void UniformArena::EndFrame() {
+        if (!s_State.RegionWritten) {
+            return;
+        }
+        s_State.Fences[s_State.CurrentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        s_State.RegionWritten = false;
+    }
+
+    uint32_t UniformArena::GetBuffer() {
+        return s_State.Buffer;
+    }
+
+}
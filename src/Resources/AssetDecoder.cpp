@@ -0,0 +1,328 @@
+#include <BunnyGL/Resources/AssetDecoder.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+namespace BunnyGL {
+
+    namespace {
+
+        // --- Images ---
+
+        void SkipWhitespaceAndComments(std::string_view data, size_t& position) {
+            while (position < data.size()) {
+                char c = data[position];
+                if (c == '#') {
+                    while (position < data.size() && data[position] != '\n') position++;
+                } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                    position++;
+                } else {
+                    break;
+                }
+            }
+        }
+
+        bool ReadHeaderNumber(std::string_view data, size_t& position, uint32_t& value) {
+            SkipWhitespaceAndComments(data, position);
+            auto result = std::from_chars(data.data() + position, data.data() + data.size(), value);
+            if (result.ec != std::errc()) {
+                return false;
+            }
+            position = static_cast<size_t>(result.ptr - data.data());
+            return true;
+        }
+
+        void FlipRows(ImageData& image) {
+            size_t row = static_cast<size_t>(image.Width) * Texture2D::GetBytesPerPixel(image.Format);
+            std::vector<uint8_t> scratch(row);
+            for (uint32_t y = 0; y < image.Height / 2; y++) {
+                uint8_t* top = image.Pixels.data() + y * row;
+                uint8_t* bottom = image.Pixels.data() + (image.Height - 1 - y) * row;
+                std::memcpy(scratch.data(), top, row);
+                std::memcpy(top, bottom, row);
+                std::memcpy(bottom, scratch.data(), row);
+            }
+        }
+
+        bool DecodeNetpbm(std::string_view data, ImageData& image, std::string& error) {
+            bool colour = data[1] == '6';
+            size_t position = 2;
+            uint32_t maxValue = 0;
+            if (!ReadHeaderNumber(data, position, image.Width) || !ReadHeaderNumber(data, position, image.Height) ||
+                !ReadHeaderNumber(data, position, maxValue)) {
+                error = "malformed PNM header";
+                return false;
+            }
+            if (maxValue != 255) {
+                error = "only 8-bit PNM images are supported";
+                return false;
+            }
+            position++;     // Single whitespace before the raster
+
+            image.Format = colour ? TextureFormat::RGB8 : TextureFormat::R8;
+            size_t size = static_cast<size_t>(image.Width) * image.Height * (colour ? 3 : 1);
+            if (image.Width == 0 || image.Height == 0 || position + size > data.size()) {
+                error = "truncated PNM raster";
+                return false;
+            }
+            image.Pixels.assign(data.begin() + position, data.begin() + position + size);
+            // PNM stores the top row first
+            FlipRows(image);
+            return true;
+        }
+
+        bool DecodeTga(std::string_view data, ImageData& image, std::string& error) {
+            if (data.size() < 18) {
+                error = "truncated TGA header";
+                return false;
+            }
+            const uint8_t* header = reinterpret_cast<const uint8_t*>(data.data());
+            uint8_t idLength = header[0];
+            uint8_t colourMapType = header[1];
+            uint8_t imageType = header[2];
+            image.Width = header[12] | (header[13] << 8);
+            image.Height = header[14] | (header[15] << 8);
+            uint8_t bitsPerPixel = header[16];
+            bool topFirst = (header[17] & 0x20) != 0;
+
+            bool rle = imageType == 10 || imageType == 11;
+            bool grey = imageType == 3 || imageType == 11;
+            if (colourMapType != 0 || !(imageType == 2 || imageType == 3 || rle)) {
+                error = "unsupported TGA type " + std::to_string(imageType);
+                return false;
+            }
+            if ((grey && bitsPerPixel != 8) || (!grey && bitsPerPixel != 24 && bitsPerPixel != 32)) {
+                error = "unsupported TGA pixel depth " + std::to_string(bitsPerPixel);
+                return false;
+            }
+
+            uint32_t bytesPerPixel = bitsPerPixel / 8;
+            image.Format = grey ? TextureFormat::R8 : (bytesPerPixel == 4 ? TextureFormat::RGBA8 : TextureFormat::RGB8);
+            size_t pixelCount = static_cast<size_t>(image.Width) * image.Height;
+            image.Pixels.resize(pixelCount * bytesPerPixel);
+
+            const uint8_t* source = header + 18 + idLength;
+            const uint8_t* end = header + data.size();
+            uint8_t* destination = image.Pixels.data();
+            if (!rle) {
+                if (source + image.Pixels.size() > end) {
+                    error = "truncated TGA raster";
+                    return false;
+                }
+                std::memcpy(destination, source, image.Pixels.size());
+            } else {
+                size_t written = 0;
+                while (written < pixelCount) {
+                    if (source >= end) {
+                        error = "truncated TGA RLE data";
+                        return false;
+                    }
+                    uint8_t packet = *source++;
+                    size_t count = std::min<size_t>((packet & 0x7F) + 1u, pixelCount - written);
+                    size_t bytes = (packet & 0x80) ? bytesPerPixel : count * bytesPerPixel;
+                    if (source + bytes > end) {
+                        error = "truncated TGA RLE data";
+                        return false;
+                    }
+                    if (packet & 0x80) {
+                        for (size_t i = 0; i < count; i++) {
+                            std::memcpy(destination + (written + i) * bytesPerPixel, source, bytesPerPixel);
+                        }
+                    } else {
+                        std::memcpy(destination + written * bytesPerPixel, source, bytes);
+                    }
+                    source += bytes;
+                    written += count;
+                }
+            }
+
+            // BGR(A) to RGB(A)
+            if (!grey) {
+                for (size_t i = 0; i < pixelCount; i++) {
+                    std::swap(destination[i * bytesPerPixel], destination[i * bytesPerPixel + 2]);
+                }
+            }
+            if (topFirst) {
+                FlipRows(image);
+            }
+            return true;
+        }
+
+        // --- Meshes ---
+
+        struct ObjCorner {
+            int Position = 0;
+            int TexCoord = 0;
+            int Normal = 0;
+
+            bool operator==(const ObjCorner& other) const {
+                return Position == other.Position && TexCoord == other.TexCoord && Normal == other.Normal;
+            }
+        };
+
+        struct ObjCornerHash {
+            size_t operator()(const ObjCorner& corner) const {
+                return (static_cast<size_t>(corner.Position) * 73856093u) ^ (static_cast<size_t>(corner.TexCoord) * 19349663u) ^
+                       (static_cast<size_t>(corner.Normal) * 83492791u);
+            }
+        };
+
+        std::string_view NextToken(std::string_view& line) {
+            size_t start = line.find_first_not_of(" \t");
+            if (start == std::string_view::npos) {
+                line = {};
+                return {};
+            }
+            size_t end = line.find_first_of(" \t", start);
+            std::string_view token = line.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+            line = end == std::string_view::npos ? std::string_view() : line.substr(end);
+            return token;
+        }
+
+        bool ParseFloats(std::string_view line, float* values, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                std::string_view token = NextToken(line);
+                if (token.empty()) {
+                    return false;
+                }
+                // std::from_chars for float isn't available everywhere yet
+                std::string text(token);
+                char* end = nullptr;
+                values[i] = std::strtof(text.c_str(), &end);
+                if (end == text.c_str()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // OBJ indices are 1-based; negative ones count back from the end
+        bool ResolveIndex(std::string_view text, size_t count, int& index) {
+            if (text.empty()) {
+                index = -1;
+                return true;
+            }
+            int value = 0;
+            auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (result.ec != std::errc() || value == 0) {
+                return false;
+            }
+            index = value > 0 ? value - 1 : static_cast<int>(count) + value;
+            return index >= 0 && static_cast<size_t>(index) < count;
+        }
+    }
+
+    bool AssetDecoder::DecodeImage(std::string_view data, ImageData& image, std::string& error) {
+        BG_PROFILE_SCOPE("AssetDecoder::DecodeImage");
+
+        image = ImageData();
+        if (data.empty()) {
+            error = "missing or empty file";
+            return false;
+        }
+        if (data.size() >= 2 && data[0] == 'P' && (data[1] == '5' || data[1] == '6')) {
+            return DecodeNetpbm(data, image, error);
+        }
+        // TGA has no magic number; the header checks reject other data
+        return DecodeTga(data, image, error);
+    }
+
+    bool AssetDecoder::DecodeMesh(std::string_view data, MeshData& mesh, std::string& error) {
+        BG_PROFILE_SCOPE("AssetDecoder::DecodeMesh");
+
+        mesh = MeshData();
+        if (data.empty()) {
+            error = "missing or empty file";
+            return false;
+        }
+        mesh.Layout.Attributes = { { 3, 0 }, { 3, 3 * sizeof(float) }, { 2, 6 * sizeof(float) } };
+        mesh.Layout.Stride = 8 * sizeof(float);
+
+        std::vector<std::array<float, 3>> positions;
+        std::vector<std::array<float, 3>> normals;
+        std::vector<std::array<float, 2>> texCoords;
+        std::unordered_map<ObjCorner, uint32_t, ObjCornerHash> vertices;
+        std::vector<uint32_t> polygon;
+
+        size_t lineNumber = 0;
+        size_t start = 0;
+        while (start < data.size()) {
+            size_t end = data.find('\n', start);
+            if (end == std::string_view::npos) end = data.size();
+            std::string_view line = data.substr(start, end - start);
+            start = end + 1;
+            ++lineNumber;
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            std::string_view keyword = NextToken(line);
+            bool ok = true;
+            if (keyword == "v") {
+                positions.emplace_back();
+                ok = ParseFloats(line, positions.back().data(), 3);
+            } else if (keyword == "vn") {
+                normals.emplace_back();
+                ok = ParseFloats(line, normals.back().data(), 3);
+            } else if (keyword == "vt") {
+                texCoords.emplace_back();
+                ok = ParseFloats(line, texCoords.back().data(), 2);
+            } else if (keyword == "f") {
+                polygon.clear();
+                for (std::string_view token = NextToken(line); ok && !token.empty(); token = NextToken(line)) {
+                    // v, v/vt, v//vn or v/vt/vn
+                    size_t first = token.find('/');
+                    size_t second = first == std::string_view::npos ? first : token.find('/', first + 1);
+                    std::string_view position = token.substr(0, first);
+                    std::string_view texCoord = first == std::string_view::npos ? std::string_view()
+                                              : token.substr(first + 1, second == std::string_view::npos ? std::string_view::npos : second - first - 1);
+                    std::string_view normal = second == std::string_view::npos ? std::string_view() : token.substr(second + 1);
+
+                    ObjCorner corner;
+                    ok = !position.empty() && ResolveIndex(position, positions.size(), corner.Position) &&
+                         ResolveIndex(texCoord, texCoords.size(), corner.TexCoord) &&
+                         ResolveIndex(normal, normals.size(), corner.Normal);
+                    if (!ok) break;
+
+                    auto [it, added] = vertices.emplace(corner, mesh.VertexCount);
+                    if (added) {
+                        const auto& p = positions[corner.Position];
+                        std::array<float, 3> n = corner.Normal >= 0 ? normals[corner.Normal] : std::array<float, 3>{ 0.0f, 0.0f, 0.0f };
+                        std::array<float, 2> t = corner.TexCoord >= 0 ? texCoords[corner.TexCoord] : std::array<float, 2>{ 0.0f, 0.0f };
+                        mesh.Vertices.insert(mesh.Vertices.end(), { p[0], p[1], p[2], n[0], n[1], n[2], t[0], t[1] });
+                        mesh.VertexCount++;
+                    }
+                    polygon.push_back(it->second);
+                }
+                ok = ok && polygon.size() >= 3;
+                for (size_t i = 2; ok && i < polygon.size(); i++) {
+                    mesh.Indices.insert(mesh.Indices.end(), { polygon[0], polygon[i - 1], polygon[i] });
+                }
+            }
+            // Everything else (o, g, s, usemtl, mtllib, comments) is ignored
+
+            if (!ok) {
+                error = "malformed '" + std::string(keyword) + "' on line " + std::to_string(lineNumber);
+                return false;
+            }
+        }
+
+        if (mesh.Indices.empty()) {
+            error = "no faces";
+            return false;
+        }
+        return true;
+    }
+
+    bool AssetDecoder::IsImageExtension(std::string_view extension) {
+        return extension == "tga" || extension == "ppm" || extension == "pgm";
+    }
+
+    bool AssetDecoder::IsMeshExtension(std::string_view extension) {
+        return extension == "obj";
+    }
+
+}
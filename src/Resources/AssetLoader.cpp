@@ -0,0 +1,184 @@
+#include <BunnyGL/Resources/AssetLoader.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BunnyGL {
+
+    namespace {
+
+        struct LoaderState {
+            std::mutex Mutex;
+            std::condition_variable WorkAvailable;
+            std::condition_variable UploadAvailable;
+            std::deque<AssetLoader::LoadFunction> Queue;
+            std::deque<AssetUpload> Completed;
+            size_t Loading = 0;             // Queued plus running
+            std::vector<std::thread> Threads;
+            bool Running = false;
+            bool Stopping = false;
+            uint64_t Uploaded = 0;
+            uint64_t BytesUploaded = 0;
+            uint64_t BytesUploadedLastFrame = 0;
+        };
+
+        LoaderState s_Loader;
+
+        void Complete(AssetUpload upload) {
+            std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+            s_Loader.Loading--;
+            if (upload.Apply) {
+                s_Loader.Completed.push_back(std::move(upload));
+            }
+            s_Loader.UploadAvailable.notify_all();
+        }
+
+        AssetUpload RunLoad(const AssetLoader::LoadFunction& load) {
+            try {
+                return load();
+            } catch (const std::exception& exception) {
+                BG_ERROR("Asset load failed: ", exception.what());
+                return {};
+            }
+        }
+
+        void LoaderLoop(uint32_t index) {
+            Profiler::SetThreadName("AssetLoader " + std::to_string(index));
+
+            while (true) {
+                AssetLoader::LoadFunction load;
+                {
+                    std::unique_lock<std::mutex> lock(s_Loader.Mutex);
+                    s_Loader.WorkAvailable.wait(lock, []() { return s_Loader.Stopping || !s_Loader.Queue.empty(); });
+                    if (s_Loader.Stopping) {
+                        return;
+                    }
+                    load = std::move(s_Loader.Queue.front());
+                    s_Loader.Queue.pop_front();
+                }
+                Complete(RunLoad(load));
+            }
+        }
+    }
+
+    void AssetLoader::Init(uint32_t threadCount) {
+        std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+        if (s_Loader.Running) {
+            return;
+        }
+        s_Loader.Running = true;
+        s_Loader.Stopping = false;
+        threadCount = std::max(threadCount, 1u);
+        for (uint32_t i = 0; i < threadCount; i++) {
+            s_Loader.Threads.emplace_back(LoaderLoop, i);
+        }
+        BG_INFO("AssetLoader: ", threadCount, " loader threads");
+    }
+
+    void AssetLoader::Shutdown() {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+            if (!s_Loader.Running) {
+                return;
+            }
+            s_Loader.Stopping = true;
+            threads = std::move(s_Loader.Threads);
+        }
+        s_Loader.WorkAvailable.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+        if (!s_Loader.Queue.empty() || !s_Loader.Completed.empty()) {
+            BG_WARN("AssetLoader: dropping ", s_Loader.Queue.size() + s_Loader.Completed.size(), " unfinished loads");
+        }
+        s_Loader.Queue.clear();
+        s_Loader.Completed.clear();
+        s_Loader.Loading = 0;
+        s_Loader.Running = false;
+    }
+
+    bool AssetLoader::IsRunning() {
+        std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+        return s_Loader.Running;
+    }
+
+    void AssetLoader::Enqueue(LoadFunction load) {
+        {
+            std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+            s_Loader.Loading++;
+            if (s_Loader.Running) {
+                s_Loader.Queue.push_back(std::move(load));
+                s_Loader.WorkAvailable.notify_one();
+                return;
+            }
+        }
+        Complete(RunLoad(load));
+    }
+
+    size_t AssetLoader::ProcessUploads(double budgetMs, size_t budgetBytes) {
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point start = Clock::now();
+        size_t applied = 0;
+        uint64_t bytes = 0;
+
+        while (true) {
+            AssetUpload upload;
+            {
+                std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+                bool overBudget = applied > 0 && (bytes + (s_Loader.Completed.empty() ? 0 : s_Loader.Completed.front().Bytes) > budgetBytes ||
+                    std::chrono::duration<double, std::milli>(Clock::now() - start).count() >= budgetMs);
+                if (s_Loader.Completed.empty() || overBudget) {
+                    s_Loader.BytesUploadedLastFrame = bytes;
+                    s_Loader.Uploaded += applied;
+                    s_Loader.BytesUploaded += bytes;
+                    return applied;
+                }
+                upload = std::move(s_Loader.Completed.front());
+                s_Loader.Completed.pop_front();
+            }
+
+            // Outside the lock: applying may queue further loads
+            BG_PROFILE_SCOPE("AssetLoader::Upload");
+            upload.Apply();
+            bytes += upload.Bytes;
+            applied++;
+        }
+    }
+
+    void AssetLoader::Flush() {
+        while (true) {
+            ProcessUploads(1.0e9, SIZE_MAX);
+
+            std::unique_lock<std::mutex> lock(s_Loader.Mutex);
+            if (s_Loader.Loading == 0 && s_Loader.Completed.empty()) {
+                return;
+            }
+            s_Loader.UploadAvailable.wait(lock, []() { return !s_Loader.Completed.empty() || s_Loader.Loading == 0; });
+        }
+    }
+
+    AssetLoaderStats AssetLoader::GetStats() {
+        std::lock_guard<std::mutex> lock(s_Loader.Mutex);
+        AssetLoaderStats stats;
+        stats.Loading = s_Loader.Loading;
+        stats.WaitingForUpload = s_Loader.Completed.size();
+        stats.Uploaded = s_Loader.Uploaded;
+        stats.BytesUploaded = s_Loader.BytesUploaded;
+        stats.BytesUploadedLastFrame = s_Loader.BytesUploadedLastFrame;
+        return stats;
+    }
+
+}
@@ -0,0 +1,201 @@
+#include <BunnyGL/Resources/CookedAsset.hpp>
+#include <BunnyGL/Resources/AssetDecoder.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace BunnyGL {
+
+    namespace {
+
+        constexpr char TextureMagic[4] = { 'B', 'G', 'T', 'X' };
+        constexpr char MeshMagic[4] = { 'B', 'G', 'M', 'S' };
+        constexpr size_t DataAlignment = 16;
+        constexpr uint32_t MaxAttributes = 16;
+
+        void Pad(std::string& blob) {
+            blob.resize((blob.size() + DataAlignment - 1) / DataAlignment * DataAlignment, '\0');
+        }
+
+        template<typename T>
+        void Append(std::string& blob, const T& value) {
+            blob.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        // 2x2 box filter; an odd edge repeats its last row or column
+        std::vector<uint8_t> Downsample(const std::vector<uint8_t>& source, uint32_t width, uint32_t height, uint32_t channels) {
+            uint32_t nextWidth = std::max(width / 2, 1u);
+            uint32_t nextHeight = std::max(height / 2, 1u);
+            std::vector<uint8_t> result(static_cast<size_t>(nextWidth) * nextHeight * channels);
+            for (uint32_t y = 0; y < nextHeight; y++) {
+                uint32_t y0 = std::min(y * 2, height - 1);
+                uint32_t y1 = std::min(y * 2 + 1, height - 1);
+                for (uint32_t x = 0; x < nextWidth; x++) {
+                    uint32_t x0 = std::min(x * 2, width - 1);
+                    uint32_t x1 = std::min(x * 2 + 1, width - 1);
+                    for (uint32_t c = 0; c < channels; c++) {
+                        uint32_t sum = source[(static_cast<size_t>(y0) * width + x0) * channels + c] +
+                                       source[(static_cast<size_t>(y0) * width + x1) * channels + c] +
+                                       source[(static_cast<size_t>(y1) * width + x0) * channels + c] +
+                                       source[(static_cast<size_t>(y1) * width + x1) * channels + c];
+                        result[(static_cast<size_t>(y) * nextWidth + x) * channels + c] = static_cast<uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+            return result;
+        }
+    }
+
+    std::string CookedAsset::CookTexture(const ImageData& image, bool mipmaps) {
+        BG_PROFILE_SCOPE("CookedAsset::CookTexture");
+
+        uint32_t channels = Texture2D::GetBytesPerPixel(image.Format);
+        uint32_t mipCount = mipmaps ? Texture2D::GetMipCount(image.Width, image.Height) : 1;
+
+        CookedTextureHeader header{};
+        std::memcpy(header.Magic, TextureMagic, 4);
+        header.Version = Version;
+        header.Width = image.Width;
+        header.Height = image.Height;
+        header.Format = static_cast<uint32_t>(image.Format);
+        header.MipCount = mipCount;
+
+        std::string blob;
+        Append(blob, header);
+        size_t offsetTable = blob.size();
+        blob.resize(blob.size() + mipCount * sizeof(uint64_t));
+
+        std::vector<uint8_t> level = image.Pixels;
+        uint32_t width = image.Width;
+        uint32_t height = image.Height;
+        for (uint32_t i = 0; i < mipCount; i++) {
+            Pad(blob);
+            uint64_t offset = blob.size();
+            std::memcpy(&blob[offsetTable + i * sizeof(uint64_t)], &offset, sizeof(offset));
+            blob.append(reinterpret_cast<const char*>(level.data()), level.size());
+            if (i + 1 < mipCount) {
+                level = Downsample(level, width, height, channels);
+                width = std::max(width / 2, 1u);
+                height = std::max(height / 2, 1u);
+            }
+        }
+        return blob;
+    }
+
+    std::string CookedAsset::CookMesh(const MeshData& mesh) {
+        BG_PROFILE_SCOPE("CookedAsset::CookMesh");
+
+        // Indices are below VertexCount, so 16 bits do whenever it's that small
+        IndexFormat format = mesh.VertexCount <= 65536 ? IndexFormat::UInt16 : IndexFormat::UInt32;
+
+        CookedMeshHeader header{};
+        std::memcpy(header.Magic, MeshMagic, 4);
+        header.Version = Version;
+        header.VertexCount = mesh.VertexCount;
+        header.IndexCount = static_cast<uint32_t>(mesh.Indices.size());
+        header.IndexFormat = static_cast<uint32_t>(format);
+        header.Stride = mesh.Layout.Stride;
+        header.AttributeCount = static_cast<uint32_t>(mesh.Layout.Attributes.size());
+
+        std::string blob;
+        Append(blob, header);
+        for (const VertexAttribute& attribute : mesh.Layout.Attributes) {
+            Append(blob, attribute);
+        }
+
+        Pad(blob);
+        header.VertexOffset = blob.size();
+        blob.append(reinterpret_cast<const char*>(mesh.Vertices.data()), static_cast<size_t>(mesh.VertexCount) * mesh.Layout.Stride);
+
+        Pad(blob);
+        header.IndexOffset = blob.size();
+        if (format == IndexFormat::UInt16) {
+            for (uint32_t index : mesh.Indices) {
+                Append(blob, static_cast<uint16_t>(index));
+            }
+        } else {
+            blob.append(reinterpret_cast<const char*>(mesh.Indices.data()), mesh.Indices.size() * sizeof(uint32_t));
+        }
+
+        std::memcpy(&blob[0], &header, sizeof(header));
+        return blob;
+    }
+
+    bool CookedAsset::ReadTexture(std::string_view blob, CookedTexture& texture, std::string& error) {
+        texture = CookedTexture();
+        CookedTextureHeader header;
+        if (blob.size() < sizeof(header)) {
+            error = blob.empty() ? "missing or empty file" : "truncated cooked texture";
+            return false;
+        }
+        std::memcpy(&header, blob.data(), sizeof(header));
+        if (std::memcmp(header.Magic, TextureMagic, 4) != 0 || header.Version != Version) {
+            error = "not a cooked texture, or cooked by another version";
+            return false;
+        }
+        if (header.Format > static_cast<uint32_t>(TextureFormat::RGBA8) || header.Width == 0 || header.Height == 0 ||
+            header.MipCount == 0 || header.MipCount > Texture2D::GetMipCount(header.Width, header.Height) ||
+            sizeof(header) + header.MipCount * sizeof(uint64_t) > blob.size()) {
+            error = "corrupt cooked texture header";
+            return false;
+        }
+
+        texture.Format = static_cast<TextureFormat>(header.Format);
+        texture.Width = header.Width;
+        texture.Height = header.Height;
+        uint32_t channels = Texture2D::GetBytesPerPixel(texture.Format);
+        uint32_t width = header.Width;
+        uint32_t height = header.Height;
+        for (uint32_t i = 0; i < header.MipCount; i++) {
+            uint64_t offset;
+            std::memcpy(&offset, blob.data() + sizeof(header) + i * sizeof(uint64_t), sizeof(offset));
+            uint64_t size = static_cast<uint64_t>(width) * height * channels;
+            if (offset > blob.size() || size > blob.size() - offset) {
+                error = "truncated mip level " + std::to_string(i);
+                return false;
+            }
+            texture.Levels.push_back(blob.data() + offset);
+            width = std::max(width / 2, 1u);
+            height = std::max(height / 2, 1u);
+        }
+        return true;
+    }
+
+    bool CookedAsset::ReadMesh(std::string_view blob, CookedMesh& mesh, std::string& error) {
+        mesh = CookedMesh();
+        CookedMeshHeader header;
+        if (blob.size() < sizeof(header)) {
+            error = blob.empty() ? "missing or empty file" : "truncated cooked mesh";
+            return false;
+        }
+        std::memcpy(&header, blob.data(), sizeof(header));
+        if (std::memcmp(header.Magic, MeshMagic, 4) != 0 || header.Version != Version) {
+            error = "not a cooked mesh, or cooked by another version";
+            return false;
+        }
+        if (header.IndexFormat > static_cast<uint32_t>(IndexFormat::UInt32) || header.AttributeCount > MaxAttributes ||
+            sizeof(header) + header.AttributeCount * sizeof(VertexAttribute) > blob.size()) {
+            error = "corrupt cooked mesh header";
+            return false;
+        }
+
+        mesh.Layout.Stride = header.Stride;
+        mesh.Layout.Attributes.resize(header.AttributeCount);
+        std::memcpy(mesh.Layout.Attributes.data(), blob.data() + sizeof(header), header.AttributeCount * sizeof(VertexAttribute));
+        mesh.VertexCount = header.VertexCount;
+        mesh.IndexCount = header.IndexCount;
+        mesh.Indices = static_cast<IndexFormat>(header.IndexFormat);
+        mesh.VertexBytes = static_cast<size_t>(header.VertexCount) * header.Stride;
+        mesh.IndexBytes = static_cast<size_t>(header.IndexCount) * Mesh::GetIndexSize(mesh.Indices);
+        if (header.VertexOffset > blob.size() || mesh.VertexBytes > blob.size() - header.VertexOffset ||
+            header.IndexOffset > blob.size() || mesh.IndexBytes > blob.size() - header.IndexOffset) {
+            error = "truncated cooked mesh";
+            return false;
+        }
+        mesh.VertexData = blob.data() + header.VertexOffset;
+        mesh.IndexData = mesh.IndexCount > 0 ? blob.data() + header.IndexOffset : nullptr;
+        return true;
+    }
+
+}
@@ -0,0 +1,16 @@
+#include <BunnyGL/Resources/EmbeddedResources.hpp>
+
+#include <algorithm>
+
+namespace BunnyGL {
+
+    std::string_view EmbeddedResources::Find(std::string_view path) {
+        const EmbeddedFile* begin = GetFiles();
+        const EmbeddedFile* end = begin + GetCount();
+        const EmbeddedFile* file = std::lower_bound(begin, end, path, [](const EmbeddedFile& candidate, std::string_view value) {
+            return candidate.Path < value;
+        });
+        return file != end && file->Path == path ? file->GetView() : std::string_view();
+    }
+
+}
@@ -0,0 +1,314 @@
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Resources/EmbeddedResources.hpp>
+#include <BunnyGL/Resources/PackArchive.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace BunnyGL {
+
+    namespace {
+
+        std::vector<std::unique_ptr<PackArchive>> s_Archives;     // Search order
+        std::shared_mutex s_ArchiveMutex;
+        std::atomic<bool> s_UseEmbedded{ true };
+
+        // Embedded files, then mounted archives. Both store normalized paths
+        // ("a/b.glsl"); most callers already pass that, so only paths that could
+        // differ pay for normalizing.
+        std::string_view FindInMemory(std::string_view filepath) {
+            bool embedded = s_UseEmbedded.load(std::memory_order_relaxed) && EmbeddedResources::GetCount() > 0;
+            std::shared_lock<std::shared_mutex> lock(s_ArchiveMutex);
+            if (!embedded && s_Archives.empty()) {
+                return {};
+            }
+
+            std::string normalized;
+            if (filepath.find("./") != std::string_view::npos || filepath.find('\\') != std::string_view::npos ||
+                filepath.find("//") != std::string_view::npos) {
+                normalized = std::filesystem::path(filepath).lexically_normal().generic_string();
+                filepath = normalized;
+            }
+            if (embedded) {
+                std::string_view data = EmbeddedResources::Find(filepath);
+                if (data.data()) {
+                    return data;
+                }
+            }
+            for (const auto& archive : s_Archives) {
+                std::string_view data = archive->Read(filepath);
+                if (data.data()) {
+                    return data;
+                }
+            }
+            return {};
+        }
+
+        bool ReadFromDisk(const std::string& filepath, std::string& buffer) {
+#if defined(__unix__) || defined(__APPLE__)
+            // One open, one fstat, and reads straight into the destination
+            int file = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat status;
+            if (file < 0 || fstat(file, &status) != 0 || !S_ISREG(status.st_mode)) {
+                if (file >= 0) ::close(file);
+                buffer.clear();
+                return false;
+            }
+            buffer.resize(static_cast<size_t>(status.st_size));
+            size_t total = 0;
+            while (total < buffer.size()) {
+                ssize_t bytes = ::read(file, buffer.data() + total, buffer.size() - total);
+                if (bytes < 0 && errno == EINTR) continue;
+                if (bytes <= 0) break;
+                total += static_cast<size_t>(bytes);
+            }
+            ::close(file);
+            // Shrunk while reading: keep what was there
+            buffer.resize(total);
+            return true;
+#else
+            std::ifstream file(filepath, std::ios::in | std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                buffer.clear();
+                return false;
+            }
+            buffer.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.resize(static_cast<size_t>(file.gcount()));
+            return true;
+#endif
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_Data = other.m_Data;
+            m_Size = other.m_Size;
+            m_Open = other.m_Open;
+            m_Mapped = other.m_Mapped;
+#if !defined(__unix__) && !defined(__APPLE__)
+            m_Buffer = std::move(other.m_Buffer);
+            m_Data = m_Buffer.data();
+#endif
+            other.m_Data = nullptr;
+            other.m_Size = 0;
+            other.m_Open = false;
+            other.m_Mapped = false;
+        }
+        return *this;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    bool MappedFile::Open(const std::string& path, FileAccess access) {
+        Close();
+
+        int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) {
+            return false;
+        }
+        struct stat status;
+        if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode)) {
+            ::close(file);
+            return false;
+        }
+
+        m_Size = static_cast<size_t>(status.st_size);
+        if (m_Size > 0) {
+            void* mapping = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(file);
+                m_Size = 0;
+                return false;
+            }
+            m_Data = static_cast<const char*>(mapping);
+            m_Mapped = true;
+        } else {
+            m_Data = "";
+        }
+        // The mapping keeps the file alive
+        ::close(file);
+        m_Open = true;
+        Advise(access);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_Mapped) {
+            munmap(const_cast<char*>(m_Data), m_Size);
+        }
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Open = false;
+        m_Mapped = false;
+    }
+
+    void MappedFile::Advise(FileAccess access) const {
+        if (!m_Mapped) {
+            return;
+        }
+        int advice = MADV_NORMAL;
+        switch (access) {
+            case FileAccess::Normal:     advice = MADV_NORMAL; break;
+            case FileAccess::Sequential: advice = MADV_SEQUENTIAL; break;
+            case FileAccess::Random:     advice = MADV_RANDOM; break;
+            case FileAccess::WillNeed:   advice = MADV_WILLNEED; break;
+        }
+        // Only a hint; failure changes nothing
+        madvise(const_cast<char*>(m_Data), m_Size, advice);
+    }
+
+#else
+
+    bool MappedFile::Open(const std::string& path, FileAccess access) {
+        Close();
+        if (!ReadFromDisk(path, m_Buffer)) {
+            return false;
+        }
+        m_Data = m_Buffer.data();
+        m_Size = m_Buffer.size();
+        m_Open = true;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        m_Buffer.clear();
+        m_Buffer.shrink_to_fit();
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Open = false;
+    }
+
+    void MappedFile::Advise(FileAccess access) const {}
+
+#endif
+
+    std::string FileSystem::ReadFile(const std::string& filepath) {
+        std::string contents;
+        ReadInto(filepath, contents);
+        return contents;
+    }
+
+    bool FileSystem::ReadInto(const std::string& filepath, std::string& buffer) {
+        std::string_view packed = FindInMemory(filepath);
+        if (packed.data()) {
+            buffer.assign(packed.data(), packed.size());
+            return true;
+        }
+
+        return ReadFromDisk(filepath, buffer);
+    }
+
+    std::string_view FileSystem::ReadView(const std::string& filepath, MappedFile& file, FileAccess access) {
+        std::string_view packed = FindInMemory(filepath);
+        if (packed.data()) {
+            file.Close();
+            return packed;
+        }
+        return file.Open(filepath, access) ? file.GetView() : std::string_view();
+    }
+
+    bool FileSystem::FileExists(const std::string& filepath) {
+        return GetFileSize(filepath) >= 0;
+    }
+
+    int64_t FileSystem::GetFileSize(const std::string& filepath) {
+        std::string_view packed = FindInMemory(filepath);
+        if (packed.data()) {
+            return static_cast<int64_t>(packed.size());
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        struct stat status;
+        if (stat(filepath.c_str(), &status) != 0 || !S_ISREG(status.st_mode)) {
+            return -1;
+        }
+        return static_cast<int64_t>(status.st_size);
+#else
+        std::error_code ec;
+        uintmax_t size = std::filesystem::file_size(filepath, ec);
+        return ec ? -1 : static_cast<int64_t>(size);
+#endif
+    }
+
+    std::string_view FileSystem::GetExtension(std::string_view filepath) {
+        std::string_view name = GetFileName(filepath);
+        size_t dotPos = name.find_last_of('.');
+        // A leading dot (".gitignore") names the file rather than starting an extension
+        if (dotPos == std::string_view::npos || dotPos == 0) {
+            return {};
+        }
+        return name.substr(dotPos + 1);
+    }
+
+    std::string_view FileSystem::GetFileName(std::string_view filepath) {
+        size_t slash = filepath.find_last_of("/\\");
+        return slash == std::string_view::npos ? filepath : filepath.substr(slash + 1);
+    }
+
+    std::string_view FileSystem::GetStem(std::string_view filepath) {
+        std::string_view name = GetFileName(filepath);
+        std::string_view extension = GetExtension(name);
+        return extension.empty() ? name : name.substr(0, name.size() - extension.size() - 1);
+    }
+
+    std::string_view FileSystem::GetDirectory(std::string_view filepath) {
+        size_t slash = filepath.find_last_of("/\\");
+        return slash == std::string_view::npos ? std::string_view() : filepath.substr(0, slash);
+    }
+
+    bool FileSystem::MountArchive(const std::string& archivePath) {
+        auto archive = std::make_unique<PackArchive>();
+        if (!archive->Open(archivePath)) {
+            return false;
+        }
+        std::unique_lock<std::shared_mutex> lock(s_ArchiveMutex);
+        s_Archives.insert(s_Archives.begin(), std::move(archive));
+        return true;
+    }
+
+    void FileSystem::UnmountArchives() {
+        std::unique_lock<std::shared_mutex> lock(s_ArchiveMutex);
+        s_Archives.clear();
+    }
+
+    bool FileSystem::HasMountedArchives() {
+        std::shared_lock<std::shared_mutex> lock(s_ArchiveMutex);
+        return !s_Archives.empty();
+    }
+
+    void FileSystem::SetUseEmbedded(bool enabled) {
+        s_UseEmbedded = enabled;
+    }
+
+    bool FileSystem::IsUsingEmbedded() {
+        return s_UseEmbedded;
+    }
+
+    std::string_view FileSystem::ReadPacked(std::string_view filepath) {
+        return FindInMemory(filepath);
+    }
+
+}
@@ -0,0 +1,184 @@
+#include <BunnyGL/Resources/FileWatcher.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <chrono>
+#include <filesystem>
+
+#ifdef __linux__
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace BunnyGL {
+
+    namespace {
+
+        namespace fs = std::filesystem;
+
+        // Quiet period that ends a batch of events
+        constexpr int SettleMs = 50;
+        // Polling fallback interval
+        constexpr int PollIntervalMs = 250;
+
+        std::string Normalize(const fs::path& path) {
+            return path.lexically_normal().generic_string();
+        }
+
+        std::string DirectoryOf(const std::string& path) {
+            std::string directory = fs::path(path).parent_path().generic_string();
+            return directory.empty() ? "." : directory;
+        }
+
+        int64_t ModifiedTime(const std::string& path) {
+            std::error_code ec;
+            fs::file_time_type time = fs::last_write_time(path, ec);
+            return ec ? -1 : static_cast<int64_t>(time.time_since_epoch().count());
+        }
+    }
+
+    FileWatcher::FileWatcher(ChangeCallback callback) : m_Callback(std::move(callback)) {
+#ifdef __linux__
+        m_INotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_INotify < 0 || pipe(m_WakePipe) != 0) {
+            BG_ERROR("FileWatcher: inotify unavailable, file changes will not be detected");
+            return;
+        }
+#endif
+        m_Running = true;
+        m_Thread = std::thread([this]() { ThreadLoop(); });
+    }
+
+    FileWatcher::~FileWatcher() {
+        m_Running = false;
+        Wake();
+        if (m_Thread.joinable()) {
+            m_Thread.join();
+        }
+#ifdef __linux__
+        if (m_INotify >= 0) close(m_INotify);
+        if (m_WakePipe[0] >= 0) close(m_WakePipe[0]);
+        if (m_WakePipe[1] >= 0) close(m_WakePipe[1]);
+#endif
+    }
+
+    void FileWatcher::Watch(const std::string& path) {
+        std::string file = Normalize(path);
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Files.insert(file).second) {
+            return;
+        }
+        m_ModifiedTimes[file] = ModifiedTime(file);
+
+#ifdef __linux__
+        // Watch the directory rather than the file: saving via rename replaces the inode
+        std::string directory = DirectoryOf(file);
+        if (m_INotify >= 0 && m_Directories.find(directory) == m_Directories.end()) {
+            int watch = inotify_add_watch(m_INotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (watch < 0) {
+                BG_WARN("FileWatcher: cannot watch ", directory);
+                return;
+            }
+            m_Directories[directory] = watch;
+        }
+#endif
+    }
+
+    void FileWatcher::Unwatch(const std::string& path) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::string file = Normalize(path);
+        m_Files.erase(file);
+        m_ModifiedTimes.erase(file);
+        // Directory watches stay; events for unwatched files are ignored
+    }
+
+    void FileWatcher::Wake() {
+#ifdef __linux__
+        if (m_WakePipe[1] >= 0) {
+            char byte = 0;
+            [[maybe_unused]] ssize_t written = write(m_WakePipe[1], &byte, 1);
+        }
+#endif
+    }
+
+#ifdef __linux__
+
+    void FileWatcher::ThreadLoop() {
+        Profiler::SetThreadName("FileWatcher");
+
+        alignas(inotify_event) char buffer[4096];
+        std::unordered_set<std::string> changed;
+
+        while (m_Running) {
+            pollfd fds[2] = { { m_INotify, POLLIN, 0 }, { m_WakePipe[0], POLLIN, 0 } };
+            // Block until something happens; once a batch has started, wait only for it to settle
+            int ready = poll(fds, 2, changed.empty() ? -1 : SettleMs);
+            if (!m_Running) {
+                break;
+            }
+
+            if (ready == 0) {
+                std::vector<std::string> batch(changed.begin(), changed.end());
+                changed.clear();
+                m_Callback(batch);
+                continue;
+            }
+            if (fds[1].revents & POLLIN) {
+                char drain[64];
+                [[maybe_unused]] ssize_t bytes = read(m_WakePipe[0], drain, sizeof(drain));
+            }
+            if (!(fds[0].revents & POLLIN)) {
+                continue;
+            }
+
+            ssize_t length;
+            while ((length = read(m_INotify, buffer, sizeof(buffer))) > 0) {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                for (char* p = buffer; p < buffer + length;) {
+                    const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+                    p += sizeof(inotify_event) + event->len;
+                    if (event->len == 0) {
+                        continue;
+                    }
+                    for (const auto& [directory, watch] : m_Directories) {
+                        if (watch != event->wd) continue;
+                        std::string file = Normalize(fs::path(directory) / event->name);
+                        if (m_Files.count(file)) {
+                            changed.insert(file);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+#else
+
+    void FileWatcher::ThreadLoop() {
+        Profiler::SetThreadName("FileWatcher");
+
+        while (m_Running) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(PollIntervalMs));
+
+            std::vector<std::string> batch;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                for (auto& [file, time] : m_ModifiedTimes) {
+                    int64_t current = ModifiedTime(file);
+                    if (current != time) {
+                        time = current;
+                        batch.push_back(file);
+                    }
+                }
+            }
+            if (!batch.empty() && m_Running) {
+                m_Callback(batch);
+            }
+        }
+    }
+
+#endif
+
+}
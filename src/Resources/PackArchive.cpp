@@ -0,0 +1,204 @@
+#include <BunnyGL/Resources/PackArchive.hpp>
+#include <BunnyGL/Core/Hash.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace BunnyGL {
+
+    namespace {
+
+        namespace fs = std::filesystem;
+
+        constexpr char ArchiveMagic[4] = { 'B', 'G', 'P', 'K' };
+
+        size_t AlignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        struct SourceFile {
+            std::string Path;           // Entry path
+            fs::path File;
+        };
+    }
+
+    bool PackArchive::Open(const std::string& path) {
+        BG_PROFILE_SCOPE("PackArchive::Open");
+
+        Close();
+        // Lookups jump around the table of contents and read single blobs
+        if (!m_File.Open(path, FileAccess::Random)) {
+            return false;
+        }
+        const char* data = m_File.GetData();
+        size_t size = m_File.GetSize();
+        if (size < sizeof(PackHeader)) {
+            BG_ERROR("PackArchive: ", path, " is not an archive");
+            Close();
+            return false;
+        }
+        m_Path = path;
+
+        // The header and table of contents are checked up front so lookups never
+        // have to bounds-check; the blobs themselves are only hashed by Verify
+        PackHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        bool valid = std::memcmp(header.Magic, ArchiveMagic, 4) == 0 && header.Version == Version && header.FileSize == size;
+        uint64_t tocEnd = sizeof(PackHeader) + static_cast<uint64_t>(header.EntryCount) * sizeof(PackEntry);
+        valid = valid && tocEnd <= header.StringsOffset && header.StringsOffset + header.StringsSize <= size;
+        if (valid) {
+            m_Entries = reinterpret_cast<const PackEntry*>(data + sizeof(PackHeader));
+            m_EntryCount = header.EntryCount;
+            m_Strings = data + header.StringsOffset;
+            for (uint32_t i = 0; valid && i < m_EntryCount; i++) {
+                const PackEntry& entry = m_Entries[i];
+                valid = static_cast<uint64_t>(entry.PathOffset) + entry.PathLength <= header.StringsSize &&
+                        entry.DataOffset <= size && entry.Size <= size - entry.DataOffset &&
+                        (i == 0 || GetEntryPath(m_Entries[i - 1]) < GetEntryPath(entry));
+            }
+        }
+        if (!valid) {
+            BG_ERROR("PackArchive: ", path, " is corrupt or from another version");
+            Close();
+            return false;
+        }
+
+        BG_INFO("PackArchive: ", path, " (", m_EntryCount, " files, ", size / 1024, " KB)");
+        return true;
+    }
+
+    void PackArchive::Close() {
+        m_File.Close();
+        m_Entries = nullptr;
+        m_EntryCount = 0;
+        m_Strings = nullptr;
+        m_Path.clear();
+    }
+
+    const PackEntry* PackArchive::Find(std::string_view path) const {
+        const PackEntry* end = m_Entries + m_EntryCount;
+        const PackEntry* entry = std::lower_bound(m_Entries, end, path, [this](const PackEntry& candidate, std::string_view value) {
+            return GetEntryPath(candidate) < value;
+        });
+        return entry != end && GetEntryPath(*entry) == path ? entry : nullptr;
+    }
+
+    std::string_view PackArchive::Read(std::string_view path) const {
+        const PackEntry* entry = Find(path);
+        return entry ? GetData(*entry) : std::string_view();
+    }
+
+    bool PackArchive::Verify(const PackEntry& entry) const {
+        return Hash64(GetData(entry)) == entry.Hash;
+    }
+
+    bool PackArchive::VerifyAll() const {
+        BG_PROFILE_SCOPE("PackArchive::VerifyAll");
+
+        bool valid = true;
+        for (uint32_t i = 0; i < m_EntryCount; i++) {
+            if (!Verify(m_Entries[i])) {
+                BG_ERROR("PackArchive: hash mismatch for ", GetEntryPath(m_Entries[i]), " in ", m_Path);
+                valid = false;
+            }
+        }
+        return valid;
+    }
+
+    bool PackArchive::Build(const std::string& directory, const std::string& outputPath, std::string& error, uint32_t alignment) {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            error = "alignment must be a power of two";
+            return false;
+        }
+
+        std::vector<SourceFile> files;
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                fs::path file = it->path();
+                files.push_back({ file.lexically_normal().generic_string(), file });
+            }
+        }
+        if (ec) {
+            error = "cannot list " + directory + ": " + ec.message();
+            return false;
+        }
+        std::sort(files.begin(), files.end(), [](const SourceFile& a, const SourceFile& b) { return a.Path < b.Path; });
+
+        std::vector<PackEntry> entries(files.size());
+        std::string strings;
+        for (size_t i = 0; i < files.size(); i++) {
+            entries[i].PathOffset = static_cast<uint32_t>(strings.size());
+            entries[i].PathLength = static_cast<uint32_t>(files[i].Path.size());
+            strings += files[i].Path;
+        }
+
+        PackHeader header{};
+        std::memcpy(header.Magic, ArchiveMagic, 4);
+        header.Version = Version;
+        header.EntryCount = static_cast<uint32_t>(entries.size());
+        header.Alignment = alignment;
+        header.StringsOffset = sizeof(PackHeader) + entries.size() * sizeof(PackEntry);
+        header.StringsSize = strings.size();
+
+        fs::path temporary = outputPath;
+        temporary += ".tmp";
+        std::ofstream output(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            error = "cannot write " + temporary.string();
+            return false;
+        }
+
+        // The header and table of contents are rewritten once the offsets are known
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackEntry)));
+        output.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+        size_t position = static_cast<size_t>(header.StringsOffset + header.StringsSize);
+        const char padding[256] = {};
+        std::string contents;
+        for (size_t i = 0; i < files.size() && output.good(); i++) {
+            if (!FileSystem::ReadInto(files[i].File.string(), contents)) {
+                error = "cannot read " + files[i].Path;
+                output.close();
+                fs::remove(temporary, ec);
+                return false;
+            }
+
+            size_t aligned = AlignUp(position, alignment);
+            for (size_t pad = aligned - position; pad > 0; pad -= std::min(pad, sizeof(padding))) {
+                output.write(padding, static_cast<std::streamsize>(std::min(pad, sizeof(padding))));
+            }
+            entries[i].DataOffset = aligned;
+            entries[i].Size = contents.size();
+            entries[i].Hash = Hash64(contents);
+            output.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            position = aligned + contents.size();
+        }
+
+        header.FileSize = position;
+        output.seekp(0);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackEntry)));
+        output.close();
+        if (!output.good()) {
+            error = "failed writing " + temporary.string();
+            fs::remove(temporary, ec);
+            return false;
+        }
+
+        fs::rename(temporary, outputPath, ec);
+        if (ec) {
+            error = "cannot replace " + outputPath + ": " + ec.message();
+            fs::remove(temporary, ec);
+            return false;
+        }
+        return true;
+    }
+
+}
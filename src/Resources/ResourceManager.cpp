@@ -1,86 +1,729 @@
 #include <BunnyGL/Resources/ResourceManager.hpp>
 #include <BunnyGL/Renderer/Shader.hpp>
+#include <BunnyGL/Renderer/Texture.hpp>
+#include <BunnyGL/Renderer/Mesh.hpp>
+#include <BunnyGL/Renderer/Buffer.hpp>
+#include <BunnyGL/Resources/AssetDecoder.hpp>
+#include <BunnyGL/Resources/AssetLoader.hpp>
+#include <BunnyGL/Resources/CookedAsset.hpp>
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Resources/FileWatcher.hpp>
+#include <BunnyGL/Core/Hash.hpp>
 #include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
 
 #include <algorithm>
+#include <chrono>
 
 namespace BunnyGL {
 
     // Initialize static members
-    std::unordered_map<std::string, std::shared_ptr<Shader>> ResourceManager::m_Shaders;
+    ResourcePool<Shader> ResourceManager::m_Shaders;
+    ResourcePool<Texture2D> ResourceManager::m_Textures;
+    ResourcePool<Mesh> ResourceManager::m_Meshes;
+    ResourcePool<Buffer> ResourceManager::m_Buffers;
+    std::unordered_map<uint64_t, ShaderHandle> ResourceManager::m_ShadersBySource;
+    ShaderLibraryStats ResourceManager::m_ShaderStats;
+    std::vector<ShaderFuture> ResourceManager::m_PreprocessingShaders;
+    std::vector<ResourceManager::PendingShader> ResourceManager::m_PendingShaders;
+    std::vector<ResourceManager::ShaderRecord> ResourceManager::m_ShaderRecords;
+    std::vector<ResourceManager::ShaderReload> ResourceManager::m_ShaderReloads;
+    std::unique_ptr<FileWatcher> ResourceManager::m_ShaderWatcher;
     std::mutex ResourceManager::m_ShaderMutex;
 
+    namespace {
+        // A resource used in frame N may still be referenced by frame N's
+        // command list while N + 1 records; leave both alone
+        constexpr uint64_t MinIdleFramesBeforeEviction = 2;
+
+        uint64_t ProgramHash(const PreprocessedShader& vertex, const PreprocessedShader& fragment) {
+            return Hash64Of(fragment.Hash, vertex.Hash);
+        }
+
+        uint64_t SizeOf(const Shader&) { return 0; }
+        uint64_t SizeOf(const Texture2D& texture) { return texture.GetSizeBytes(); }
+        uint64_t SizeOf(const Mesh& mesh) { return mesh.GetSizeBytes(); }
+        uint64_t SizeOf(const Buffer& buffer) { return buffer.GetSize(); }
+
+        // Least recently used first, until the pool fits its budget again
+        template<typename T>
+        size_t EvictOverBudget(ResourcePool<T>& pool, const char* type) {
+            uint64_t budget = pool.GetBudget();
+            ResidencyStats stats = pool.GetResidencyStats();
+            if (budget == 0 || stats.ResidentBytes <= budget) {
+                return 0;
+            }
+            BG_PROFILE_SCOPE("ResourceManager::EvictOverBudget");
+
+            uint64_t frame = pool.GetFrame();
+            uint64_t resident = stats.ResidentBytes;
+            size_t evicted = 0;
+            for (const auto& entry : pool.GetEvictionCandidates()) {
+                if (resident <= budget || entry.LastUsedFrame + MinIdleFramesBeforeEviction > frame) {
+                    break;
+                }
+                // Destroyed here, outside the pool's lock
+                if (pool.Evict(entry.Resource, frame, MinIdleFramesBeforeEviction)) {
+                    resident -= entry.SizeBytes;
+                    evicted++;
+                }
+            }
+            if (evicted > 0) {
+                BG_LOG(Debug, Resources, "Evicted ", evicted, " ", type, " resources, ", resident, " of ", budget, " bytes resident");
+            }
+            return evicted;
+        }
+    }
+
     // Load or get cached shader
-    std::shared_ptr<Shader> ResourceManager::LoadShader(const std::string& name,const std::string& vertexPath,  const std::string& fragmentPath) {
+    ShaderHandle ResourceManager::LoadShader(const std::string& name,const std::string& vertexPath,  const std::string& fragmentPath,
+                                             const ShaderDefines& defines) {
+        BG_PROFILE_SCOPE("ResourceManager::LoadShader");
 
         std::lock_guard<std::mutex> lock(m_ShaderMutex);
         // Check if already loaded
-        auto it = m_Shaders.find(name);
-        if (it != m_Shaders.end()) {
+        if (ShaderHandle cached = m_Shaders.Find(name)) {
             BG_WARN("Shader ",name," already loaded, returning cached version");
-            return it->second;
+            return cached;
         }
 
-        try {
-            auto shader = std::make_shared<Shader>(vertexPath, fragmentPath);
+        PreprocessedShader vertex = ShaderPreprocessor::Process(vertexPath, defines);
+        PreprocessedShader fragment = ShaderPreprocessor::Process(fragmentPath, defines);
+        if (!vertex.Success || !fragment.Success) {
+            BG_FATAL("Failed to load shader files:", vertexPath, " or ", fragmentPath);
+            return {};
+        }
 
-            if (!shader || shader->GetRendererID() == 0) {
-                BG_FATAL("Failed to create shader", name);
-                return nullptr;
-            }
+        m_ShaderStats.Requests++;
+        uint64_t sourceHash = ProgramHash(vertex, fragment);
+        if (ShaderHandle existing = FindBySource(sourceHash)) {
+            BG_LOG(Debug, Renderer, "Shader ", name, " is identical to an already loaded program, sharing it");
+            m_ShaderStats.Deduplicated++;
+            m_Shaders.AddName(name, existing);
+            return existing;
+        }
 
-            m_Shaders[name] = shader;
+        // Same source already compiling asynchronously: finish that one instead
+        auto pending = std::find_if(m_PendingShaders.begin(), m_PendingShaders.end(),
+            [&](const PendingShader& shader) { return shader.SourceHash == sourceHash; });
+        if (pending != m_PendingShaders.end()) {
+            m_ShaderStats.Deduplicated++;
+            ShaderHandle shader = FinishPending(*pending);
+            m_PendingShaders.erase(pending);
+            m_Shaders.AddName(name, shader);
             return shader;
+        }
 
-        } catch (const std::exception& e) {
-            BG_FATAL("Exception while loading shader ",name, " : ", e.what());
-            return nullptr;
+        ShaderCompileJob job = ShaderCompiler::Submit(vertex.Source, fragment.Source);
+        unsigned int program = ShaderCompiler::Finish(job);
+        if (program == 0) {
+            Shader::LogSourceFiles(vertex, fragment);
+            BG_FATAL("Failed to create shader", name);
+            return {};
         }
+
+        ShaderHandle shader = m_Shaders.Add(std::make_unique<Shader>(program), name);
+        m_ShadersBySource[sourceHash] = shader;
+        TrackShader(shader, vertex, fragment, defines, sourceHash);
+        return shader;
     }
 
-    // Get existing shader
-    std::shared_ptr<Shader> ResourceManager::GetShader(const std::string& name) {
+    // Submit a batch of shaders without waiting for any of them
+    std::vector<ShaderFuture> ResourceManager::LoadShaders(const std::vector<ShaderSource>& sources) {
+        BG_PROFILE_SCOPE("ResourceManager::LoadShaders");
+
+        std::vector<ShaderFuture> futures;
+        futures.reserve(sources.size());
+
+        std::lock_guard<std::mutex> lock(m_ShaderMutex);
+        for (const ShaderSource& source : sources) {
+            ShaderFuture future;
+            future.m_State = std::make_shared<ShaderFuture::State>();
+            future.m_State->Name = source.Name;
+            futures.push_back(future);
+
+            auto complete = [&](ShaderHandle shader) {
+                future.m_State->Result = shader;
+                future.m_State->Current.store(ShaderFuture::Status::Ready, std::memory_order_release);
+            };
+
+            // Already loaded or already in flight under this name
+            if (ShaderHandle cached = m_Shaders.Find(source.Name)) {
+                complete(cached);
+                continue;
+            }
+            bool inFlight = false;
+            for (const ShaderFuture& other : m_PreprocessingShaders) {
+                if (other.GetName() == source.Name) {
+                    futures.back() = other;
+                    inFlight = true;
+                }
+            }
+            for (PendingShader& pending : m_PendingShaders) {
+                for (const ShaderFuture& other : pending.Futures) {
+                    if (other.GetName() == source.Name) {
+                        futures.back() = other;
+                        inFlight = true;
+                    }
+                }
+            }
+            if (inFlight) {
+                continue;
+            }
+
+            // File I/O and preprocessing on a loader thread; the compile is submitted from the upload queue
+            m_PreprocessingShaders.push_back(future);
+            AssetLoader::Enqueue([future, source]() {
+                auto vertex = std::make_shared<PreprocessedShader>(ShaderPreprocessor::Process(source.VertexPath, source.Defines));
+                auto fragment = std::make_shared<PreprocessedShader>(ShaderPreprocessor::Process(source.FragmentPath, source.Defines));
+                if (!vertex->Success || !fragment->Success) {
+                    BG_ERROR("Failed to load shader files:", source.VertexPath, " or ", source.FragmentPath);
+                }
+                AssetUpload upload;
+                upload.Apply = [future, defines = source.Defines, vertex, fragment]() {
+                    SubmitShader(future, defines, *vertex, *fragment);
+                };
+                return upload;
+            });
+        }
+        return futures;
+    }
+
+    void ResourceManager::SubmitShader(ShaderFuture future, const ShaderDefines& defines, PreprocessedShader& vertex, PreprocessedShader& fragment) {
+        std::lock_guard<std::mutex> lock(m_ShaderMutex);
+        auto waiting = std::find_if(m_PreprocessingShaders.begin(), m_PreprocessingShaders.end(),
+            [&](const ShaderFuture& other) { return other.m_State == future.m_State; });
+        if (waiting == m_PreprocessingShaders.end()) {
+            return;     // Cleared meanwhile
+        }
+        m_PreprocessingShaders.erase(waiting);
+
+        const std::string& name = future.GetName();
+        if (!vertex.Success || !fragment.Success) {
+            future.m_State->Current.store(ShaderFuture::Status::Failed, std::memory_order_release);
+            return;
+        }
+
+        // Identical program already loaded or compiling under another name
+        m_ShaderStats.Requests++;
+        uint64_t sourceHash = ProgramHash(vertex, fragment);
+        if (ShaderHandle existing = FindBySource(sourceHash)) {
+            m_ShaderStats.Deduplicated++;
+            m_Shaders.AddName(name, existing);
+            future.m_State->Result = existing;
+            future.m_State->Current.store(ShaderFuture::Status::Ready, std::memory_order_release);
+            return;
+        }
+        auto pending = std::find_if(m_PendingShaders.begin(), m_PendingShaders.end(),
+            [&](const PendingShader& shader) { return shader.SourceHash == sourceHash; });
+        if (pending != m_PendingShaders.end()) {
+            m_ShaderStats.Deduplicated++;
+            pending->Futures.push_back(future);
+            return;
+        }
+
+        ShaderCompileJob job = ShaderCompiler::Submit(vertex.Source, fragment.Source);
+        m_PendingShaders.push_back({ sourceHash, job, { future }, std::move(vertex), std::move(fragment), defines });
+    }
+
+    ShaderFuture ResourceManager::LoadShaderAsync(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+                                                  const ShaderDefines& defines) {
+        return LoadShaders({ ShaderSource{ name, vertexPath, fragmentPath, defines } }).front();
+    }
+
+    size_t ResourceManager::PollShaders(double budgetMs) {
         std::lock_guard<std::mutex> lock(m_ShaderMutex);
+        if (m_PendingShaders.empty() && m_ShaderReloads.empty()) {
+            return 0;
+        }
+        BG_PROFILE_SCOPE("ResourceManager::PollShaders");
+
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point start = Clock::now();
+        size_t finished = 0;
+        // Without parallel compile each Submit/Finish blocks, so stop once over budget (always do at least one)
+        auto overBudget = [&]() {
+            return finished > 0 && std::chrono::duration<double, std::milli>(Clock::now() - start).count() >= budgetMs;
+        };
+
+        for (auto it = m_PendingShaders.begin(); it != m_PendingShaders.end() && !overBudget();) {
+            if (!ShaderCompiler::IsComplete(it->Job)) {
+                ++it;
+                continue;
+            }
+
+            FinishPending(*it);
+            it = m_PendingShaders.erase(it);
+            ++finished;
+        }
+
+        for (auto it = m_ShaderReloads.begin(); it != m_ShaderReloads.end() && !overBudget();) {
+            if (!it->Submitted) {
+                it->Job = ShaderCompiler::Submit(it->Vertex.Source, it->Fragment.Source);
+                it->Submitted = true;
+            }
+            if (!ShaderCompiler::IsComplete(it->Job)) {
+                ++it;
+                continue;
+            }
+
+            FinishReload(*it);
+            it = m_ShaderReloads.erase(it);
+            ++finished;
+        }
+        return finished;
+    }
+
+    ShaderHandle ResourceManager::FindBySource(uint64_t sourceHash) {
+        auto it = m_ShadersBySource.find(sourceHash);
+        if (it == m_ShadersBySource.end()) {
+            return {};
+        }
+        // Entries of unloaded programs are dropped lazily
+        if (!m_Shaders.IsAlive(it->second)) {
+            m_ShadersBySource.erase(it);
+            return {};
+        }
+        return it->second;
+    }
+
+    // Completes every future waiting on this program
+    ShaderHandle ResourceManager::FinishPending(PendingShader& pending) {
+        ShaderHandle shader;
+        unsigned int program = ShaderCompiler::Finish(pending.Job);
+        if (program != 0) {
+            shader = m_Shaders.Add(std::make_unique<Shader>(program));
+            m_ShadersBySource[pending.SourceHash] = shader;
+            TrackShader(shader, pending.Vertex, pending.Fragment, pending.Defines, pending.SourceHash);
+        } else {
+            Shader::LogSourceFiles(pending.Vertex, pending.Fragment);
+        }
+
+        for (ShaderFuture& future : pending.Futures) {
+            ShaderFuture::State& state = *future.m_State;
+            if (shader) {
+                state.Result = shader;
+                m_Shaders.AddName(state.Name, shader);
+                state.Current.store(ShaderFuture::Status::Ready, std::memory_order_release);
+            } else {
+                BG_ERROR("Failed to create shader ", state.Name);
+                state.Current.store(ShaderFuture::Status::Failed, std::memory_order_release);
+            }
+        }
+        return shader;
+    }
+
+    void ResourceManager::FinishShaders() {
+        while (GetPendingShaderCount() > 0) {
+            AssetLoader::Flush();
+            PollShaders(1.0e9);
+        }
+    }
+
+    size_t ResourceManager::GetPendingShaderCount() {
+        std::lock_guard<std::mutex> lock(m_ShaderMutex);
+        return m_PreprocessingShaders.size() + m_PendingShaders.size();
+    }
+
+    TextureHandle ResourceManager::LoadTexture(const std::string& path, const TextureSpecification& sampling) {
+        if (TextureHandle existing = m_Textures.Find(path)) {
+            return existing;
+        }
+        TextureHandle handle = m_Textures.Reserve(path, [path, sampling](TextureHandle reload) {
+            EnqueueTextureLoad(reload, path, sampling);
+        });
+        if (!handle) {
+            // Lost a race with another thread loading the same path
+            return m_Textures.Find(path);
+        }
+        EnqueueTextureLoad(handle, path, sampling);
+        return handle;
+    }
+
+    MeshHandle ResourceManager::LoadMesh(const std::string& path) {
+        if (MeshHandle existing = m_Meshes.Find(path)) {
+            return existing;
+        }
+        MeshHandle handle = m_Meshes.Reserve(path, [path](MeshHandle reload) { EnqueueMeshLoad(reload, path); });
+        if (!handle) {
+            return m_Meshes.Find(path);
+        }
+        EnqueueMeshLoad(handle, path);
+        return handle;
+    }
+
+    void ResourceManager::EnqueueTextureLoad(TextureHandle handle, const std::string& path, const TextureSpecification& sampling) {
+        AssetLoader::Enqueue([handle, path, sampling]() {
+            std::string error;
+            AssetUpload upload;
+            if (CookedAsset::IsTextureExtension(FileSystem::GetExtension(path))) {
+                // The upload reads the levels out of the mapping, which it keeps alive
+                auto file = std::make_shared<MappedFile>();
+                auto cooked = std::make_shared<CookedTexture>();
+                std::string_view blob = FileSystem::ReadView(path, *file);
+                if (!CookedAsset::ReadTexture(blob, *cooked, error)) {
+                    BG_ERROR("Failed to load texture ", path, ": ", error);
+                    upload.Apply = [handle]() { m_Textures.Fail(handle); };
+                    return upload;
+                }
+                upload.Bytes = blob.size();
+                upload.Apply = [handle, file, cooked, sampling]() {
+                    TextureSpecification specification = sampling;
+                    specification.Width = cooked->Width;
+                    specification.Height = cooked->Height;
+                    specification.Format = cooked->Format;
+                    uint32_t levels = sampling.Mipmaps ? static_cast<uint32_t>(cooked->Levels.size()) : 1;
+                    auto texture = std::make_unique<Texture2D>(specification, cooked->Levels.data(), levels);
+                    uint64_t size = texture->GetSizeBytes();
+                    m_Textures.Fill(handle, std::move(texture), size);
+                };
+                return upload;
+            }
+
+            auto image = std::make_shared<ImageData>();
+            MappedFile file;
+            if (!AssetDecoder::DecodeImage(FileSystem::ReadView(path, file), *image, error)) {
+                BG_ERROR("Failed to load texture ", path, ": ", error);
+                upload.Apply = [handle]() { m_Textures.Fail(handle); };
+                return upload;
+            }
 
-        auto it = m_Shaders.find(name);
-        if (it != m_Shaders.end()) {
-            return it->second;
+            upload.Bytes = image->Pixels.size();
+            upload.Apply = [handle, image, sampling]() {
+                TextureSpecification specification = sampling;
+                specification.Width = image->Width;
+                specification.Height = image->Height;
+                specification.Format = image->Format;
+                auto texture = std::make_unique<Texture2D>(specification, image->Pixels.data());
+                uint64_t size = texture->GetSizeBytes();
+                m_Textures.Fill(handle, std::move(texture), size);
+            };
+            return upload;
+        });
+    }
+
+    void ResourceManager::EnqueueMeshLoad(MeshHandle handle, const std::string& path) {
+        AssetLoader::Enqueue([handle, path]() {
+            std::string error;
+            AssetUpload upload;
+            if (CookedAsset::IsMeshExtension(FileSystem::GetExtension(path))) {
+                auto file = std::make_shared<MappedFile>();
+                auto cooked = std::make_shared<CookedMesh>();
+                if (!CookedAsset::ReadMesh(FileSystem::ReadView(path, *file), *cooked, error)) {
+                    BG_ERROR("Failed to load mesh ", path, ": ", error);
+                    upload.Apply = [handle]() { m_Meshes.Fail(handle); };
+                    return upload;
+                }
+                upload.Bytes = cooked->VertexBytes + cooked->IndexBytes;
+                upload.Apply = [handle, file, cooked]() {
+                    auto mesh = std::make_unique<Mesh>(cooked->Layout, cooked->VertexData, cooked->VertexCount,
+                                                       cooked->IndexData, cooked->IndexCount, cooked->Indices);
+                    uint64_t size = mesh->GetSizeBytes();
+                    m_Meshes.Fill(handle, std::move(mesh), size);
+                };
+                return upload;
+            }
+
+            auto data = std::make_shared<MeshData>();
+            MappedFile file;
+            if (!AssetDecoder::DecodeMesh(FileSystem::ReadView(path, file), *data, error)) {
+                BG_ERROR("Failed to load mesh ", path, ": ", error);
+                upload.Apply = [handle]() { m_Meshes.Fail(handle); };
+                return upload;
+            }
+
+            upload.Bytes = data->Vertices.size() * sizeof(float) + data->Indices.size() * sizeof(uint32_t);
+            upload.Apply = [handle, data]() {
+                auto mesh = std::make_unique<Mesh>(data->Layout, data->Vertices.data(), data->VertexCount,
+                                                   data->Indices.data(), static_cast<uint32_t>(data->Indices.size()));
+                uint64_t size = mesh->GetSizeBytes();
+                m_Meshes.Fill(handle, std::move(mesh), size);
+            };
+            return upload;
+        });
+    }
+
+    // Get existing shader
+    ShaderHandle ResourceManager::GetShader(const std::string& name) {
+        ShaderHandle shader = m_Shaders.Find(name);
+        if (!shader) {
+            BG_WARN("Shader ",name," not found in cache");
         }
-        BG_WARN("Shader ",name," not found in cache");
-        return nullptr;
+        return shader;
     }
 
     // Check if shader exists
     bool ResourceManager::HasShader(const std::string& name) {
-        std::lock_guard<std::mutex> lock(m_ShaderMutex);
-        return m_Shaders.find(name) != m_Shaders.end();
+        return m_Shaders.Find(name).IsValid();
+    }
+
+    void ResourceManager::UnloadShader(const std::string& name) {
+        std::unique_ptr<Shader> shader;
+        {
+            std::lock_guard<std::mutex> lock(m_ShaderMutex);
+            shader = m_Shaders.RemoveName(name);
+        }
+        // Source and hot reload records of the program expire with its handle
     }
 
     // Get all loaded shader names
     std::vector<std::string> ResourceManager::GetLoadedShaders() {
+        return m_Shaders.GetNames();
+    }
+
+    template<> ResourcePool<Shader>& ResourceManager::GetPool<Shader>() { return m_Shaders; }
+    template<> ResourcePool<Texture2D>& ResourceManager::GetPool<Texture2D>() { return m_Textures; }
+    template<> ResourcePool<Mesh>& ResourceManager::GetPool<Mesh>() { return m_Meshes; }
+    template<> ResourcePool<Buffer>& ResourceManager::GetPool<Buffer>() { return m_Buffers; }
+
+    template<typename T>
+    ResourceHandle<T> ResourceManager::Add(const std::string& name, std::unique_ptr<T> resource) {
+        uint64_t size = resource ? SizeOf(*resource) : 0;
+        ResourceHandle<T> handle = GetPool<T>().Add(std::move(resource), name, size);
+        if (!handle) {
+            BG_ERROR("Cannot register resource ", name, ": name already in use or pool full");
+        }
+        return handle;
+    }
+
+    template<typename T>
+    ResourceHandle<T> ResourceManager::Find(const std::string& name) {
+        return GetPool<T>().Find(name);
+    }
+
+    template<typename T>
+    T* ResourceManager::Get(ResourceHandle<T> handle) {
+        ResourceState state;
+        T* resource = GetPool<T>().Get(handle, state);
+        if (state == ResourceState::Evicted) {
+            GetPool<T>().RequestReload(handle);
+        }
+        return resource;
+    }
+
+    template<typename T>
+    bool ResourceManager::Destroy(ResourceHandle<T> handle) {
+        bool alive = GetPool<T>().IsAlive(handle);
+        // Deleted here, after the pool's lock is released
+        GetPool<T>().Remove(handle);
+        return alive;
+    }
+
+    template<typename T>
+    ResourceState ResourceManager::GetState(ResourceHandle<T> handle) {
+        return GetPool<T>().GetState(handle);
+    }
+
+    template<typename T>
+    size_t ResourceManager::GetCount() {
+        return GetPool<T>().GetCount();
+    }
+
+    template<typename T>
+    void ResourceManager::SetMemoryBudget(uint64_t bytes) {
+        GetPool<T>().SetBudget(bytes);
+    }
+
+    template<typename T>
+    ResidencyStats ResourceManager::GetResidencyStats() {
+        return GetPool<T>().GetResidencyStats();
+    }
+
+#define BG_INSTANTIATE_RESOURCE(Type) \
+    template ResourceHandle<Type> ResourceManager::Add<Type>(const std::string&, std::unique_ptr<Type>); \
+    template ResourceHandle<Type> ResourceManager::Find<Type>(const std::string&); \
+    template Type* ResourceManager::Get<Type>(ResourceHandle<Type>); \
+    template bool ResourceManager::Destroy<Type>(ResourceHandle<Type>); \
+    template ResourceState ResourceManager::GetState<Type>(ResourceHandle<Type>); \
+    template size_t ResourceManager::GetCount<Type>(); \
+    template void ResourceManager::SetMemoryBudget<Type>(uint64_t); \
+    template ResidencyStats ResourceManager::GetResidencyStats<Type>();
+
+    BG_INSTANTIATE_RESOURCE(Shader)
+    BG_INSTANTIATE_RESOURCE(Texture2D)
+    BG_INSTANTIATE_RESOURCE(Mesh)
+    BG_INSTANTIATE_RESOURCE(Buffer)
+
+#undef BG_INSTANTIATE_RESOURCE
+
+    void ResourceManager::BeginFrame(uint64_t frameIndex) {
+        m_Shaders.SetFrame(frameIndex);
+        m_Textures.SetFrame(frameIndex);
+        m_Meshes.SetFrame(frameIndex);
+        m_Buffers.SetFrame(frameIndex);
+    }
+
+    size_t ResourceManager::EnforceMemoryBudgets() {
+        size_t evicted = EvictOverBudget(m_Textures, "texture");
+        evicted += EvictOverBudget(m_Meshes, "mesh");
+        return evicted;
+    }
+
+    void ResourceManager::TrackShader(ShaderHandle shader, const PreprocessedShader& vertex, const PreprocessedShader& fragment,
+                                      const ShaderDefines& defines, uint64_t sourceHash) {
+        ShaderRecord record{ shader, vertex.Files.front(), fragment.Files.front(), defines, vertex.Files, sourceHash };
+        record.Files.insert(record.Files.end(), fragment.Files.begin(), fragment.Files.end());
+
+        if (m_ShaderWatcher) {
+            for (const std::string& file : record.Files) {
+                m_ShaderWatcher->Watch(file);
+            }
+        }
+        m_ShaderRecords.push_back(std::move(record));
+    }
+
+    void ResourceManager::SetShaderHotReload(bool enabled) {
+        std::unique_ptr<FileWatcher> stopped;
+        {
+            std::lock_guard<std::mutex> lock(m_ShaderMutex);
+            if (enabled == (m_ShaderWatcher != nullptr)) {
+                return;
+            }
+            if (!enabled) {
+                // Joined outside the lock; its callback takes the lock too
+                stopped = std::move(m_ShaderWatcher);
+            } else {
+                m_ShaderWatcher = std::make_unique<FileWatcher>(&ResourceManager::OnShaderFilesChanged);
+                for (const ShaderRecord& record : m_ShaderRecords) {
+                    for (const std::string& file : record.Files) {
+                        m_ShaderWatcher->Watch(file);
+                    }
+                }
+                BG_INFO("Shader hot reload enabled");
+            }
+        }
+    }
+
+    bool ResourceManager::IsShaderHotReloadEnabled() {
         std::lock_guard<std::mutex> lock(m_ShaderMutex);
+        return m_ShaderWatcher != nullptr;
+    }
 
-        std::vector<std::string> names;
-        names.reserve(m_Shaders.size());
+    // Runs on the watcher thread, so file I/O and preprocessing stay off the frame
+    void ResourceManager::OnShaderFilesChanged(const std::vector<std::string>& paths) {
+        BG_PROFILE_SCOPE("ResourceManager::OnShaderFilesChanged");
 
-        for (const auto& pair : m_Shaders) {
-            names.push_back(pair.first);
+        std::vector<ShaderRecord> affected;
+        {
+            std::lock_guard<std::mutex> lock(m_ShaderMutex);
+            m_ShaderRecords.erase(std::remove_if(m_ShaderRecords.begin(), m_ShaderRecords.end(),
+                [](const ShaderRecord& record) { return !m_Shaders.IsAlive(record.Program); }), m_ShaderRecords.end());
+
+            for (const ShaderRecord& record : m_ShaderRecords) {
+                bool uses = std::any_of(paths.begin(), paths.end(), [&](const std::string& path) {
+                    return std::find(record.Files.begin(), record.Files.end(), path) != record.Files.end();
+                });
+                if (uses) affected.push_back(record);
+            }
         }
 
-        return names;
+        for (const ShaderRecord& record : affected) {
+            PreprocessedShader vertex = ShaderPreprocessor::Process(record.VertexPath, record.Defines);
+            PreprocessedShader fragment = ShaderPreprocessor::Process(record.FragmentPath, record.Defines);
+            if (!vertex.Success || !fragment.Success) {
+                BG_ERROR("Hot reload of ", record.VertexPath, " / ", record.FragmentPath, " failed, keeping the current program");
+                continue;
+            }
+
+            uint64_t sourceHash = ProgramHash(vertex, fragment);
+            if (sourceHash == record.SourceHash) {
+                continue;   // Saved without a change that reaches the compiler
+            }
+            BG_INFO("Reloading shader ", record.VertexPath, " / ", record.FragmentPath);
+
+            std::lock_guard<std::mutex> lock(m_ShaderMutex);
+            // A newer edit supersedes a reload that hasn't been submitted yet
+            m_ShaderReloads.erase(std::remove_if(m_ShaderReloads.begin(), m_ShaderReloads.end(), [&](const ShaderReload& reload) {
+                return !reload.Submitted && reload.Target == record.Program;
+            }), m_ShaderReloads.end());
+
+            ShaderReload reload;
+            reload.Target = record.Program;
+            reload.SourceHash = sourceHash;
+            reload.Vertex = std::move(vertex);
+            reload.Fragment = std::move(fragment);
+            m_ShaderReloads.push_back(std::move(reload));
+        }
+    }
+
+    // GL thread, between frames
+    void ResourceManager::FinishReload(ShaderReload& reload) {
+        Shader* shader = m_Shaders.Get(reload.Target);
+        if (!shader) {
+            ShaderCompiler::Cancel(reload.Job);
+            return;
+        }
+
+        unsigned int program = ShaderCompiler::Finish(reload.Job);
+        if (program == 0) {
+            Shader::LogSourceFiles(reload.Vertex, reload.Fragment);
+            BG_ERROR("Hot reload failed to build, keeping the current program");
+            return;
+        }
+        shader->ReplaceProgram(program);
+
+        for (ShaderRecord& record : m_ShaderRecords) {
+            if (record.Program != reload.Target) {
+                continue;
+            }
+            m_ShadersBySource.erase(record.SourceHash);
+            record.SourceHash = reload.SourceHash;
+
+            // Includes may have been added or removed
+            record.Files = reload.Vertex.Files;
+            record.Files.insert(record.Files.end(), reload.Fragment.Files.begin(), reload.Fragment.Files.end());
+            if (m_ShaderWatcher) {
+                for (const std::string& file : record.Files) {
+                    m_ShaderWatcher->Watch(file);
+                }
+            }
+        }
+        m_ShadersBySource[reload.SourceHash] = reload.Target;
+        BG_INFO("Shader reloaded (program ID:", program, ")");
+    }
+
+    ShaderLibraryStats ResourceManager::GetShaderStats() {
+        std::lock_guard<std::mutex> lock(m_ShaderMutex);
+
+        ShaderLibraryStats stats = m_ShaderStats;
+        stats.Programs = m_Shaders.GetCount();
+        return stats;
     }
 
     // Clear all shaders
     void ResourceManager::ClearShaders() {
         std::lock_guard<std::mutex> lock(m_ShaderMutex);
 
-        size_t count = m_Shaders.size();
-        m_Shaders.clear();
+        size_t count = m_Shaders.GetCount();
+        m_Shaders.Clear();
+
+        m_ShadersBySource.clear();
+        m_ShaderRecords.clear();
+
+        for (ShaderReload& reload : m_ShaderReloads) {
+            ShaderCompiler::Cancel(reload.Job);
+        }
+        m_ShaderReloads.clear();
+
+        for (ShaderFuture& future : m_PreprocessingShaders) {
+            future.m_State->Current.store(ShaderFuture::Status::Failed, std::memory_order_release);
+        }
+        m_PreprocessingShaders.clear();
+
+        for (PendingShader& pending : m_PendingShaders) {
+            ShaderCompiler::Cancel(pending.Job);
+            for (ShaderFuture& future : pending.Futures) {
+                future.m_State->Current.store(ShaderFuture::Status::Failed, std::memory_order_release);
+            }
+        }
+        m_PendingShaders.clear();
     }
 
     // Clear all resources
     void ResourceManager::ClearAll() {
         ClearShaders();
-        // Add other resource types here as you implement them
+        m_Textures.Clear();
+        m_Meshes.Clear();
+        m_Buffers.Clear();
     }
 }
\ No newline at end of file
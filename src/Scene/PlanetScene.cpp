@@ -1,9 +1,16 @@
 #include <BunnyGL/Scene/PlanetScene.hpp>
 #include <BunnyGL/Core/Log.hpp>
-#include <glad/glad.h>
+#include <BunnyGL/Renderer/UniformArena.hpp>
 
 namespace BunnyGL {
 
+    namespace {
+        // Matches the Object block in include/Transform.glsl
+        struct ObjectUniforms {
+            Std140::Mat4 Transform;
+        };
+    }
+
     PlanetScene::PlanetScene() {
         BG_INFO("PlanetScene created");
     }
@@ -17,50 +24,59 @@ namespace BunnyGL {
         BG_INFO("PlanetScene attached");
         
         m_Shader = ResourceManager::LoadShader("planet",
-            "resources/shaders/Planet.vert",
-            "resources/shaders/Planet.frag");
+            "resources/shaders/Colored.vert",
+            "resources/shaders/Colored.frag",
+            { { "BG_OBJECT_BLOCK", "" } });
         
-        if (!m_Shader) {
+        Shader* shader = ResourceManager::Get(m_Shader);
+        if (!shader) {
             BG_ERROR("Failed to load shader!");
             return;
         }
+        shader->BindUniformBlock<ObjectUniforms>("Object", UniformBinding::Object);
         
+        PipelineDescription pipeline;
+        pipeline.Program = shader;
+        m_Pipeline = PipelineState(pipeline);
+
         SetupTriangle();
     }
     
     void PlanetScene::OnDetach() {
         BG_INFO("PlanetScene detached");
-        if (m_VAO) glDeleteVertexArrays(1, &m_VAO);
-        if (m_VBO) glDeleteBuffers(1, &m_VBO);
-        m_VAO = m_VBO = 0;
+        ResourceManager::Destroy(m_Mesh);
+        m_Mesh = {};
     }
     
     void PlanetScene::OnUpdate(float deltaTime) {
+        m_PreviousRotationAngle = m_RotationAngle;
         m_RotationAngle += 90.0f * deltaTime;
         if (m_RotationAngle > 360.0f) {
             m_RotationAngle -= 360.0f;
+            m_PreviousRotationAngle -= 360.0f;
         }
     }
     
-    void PlanetScene::OnRender() {
-        if (!m_Shader) return;
+    void PlanetScene::OnRender(CommandList& commands, float alpha) {
+        Mesh* mesh = ResourceManager::Get(m_Mesh);
+        if (!mesh) return;
         
-        m_Shader->Bind();
+        commands.BindPipeline(&m_Pipeline);
         
-        float angleRadians = glm::radians(m_RotationAngle);
+        float angle = m_PreviousRotationAngle + (m_RotationAngle - m_PreviousRotationAngle) * alpha;
+        float angleRadians = glm::radians(angle);
         glm::mat4 transform = glm::rotate(
             glm::mat4(1.0f), 
             angleRadians, 
             glm::vec3(0.0f, 0.0f, 1.0f)
         );
         
-        m_Shader->SetUniformMat4f("u_Transform", transform);
-        
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-        glBindVertexArray(0);
+        ObjectUniforms object;
+        object.Transform = transform;
+        commands.BindUniformBlock(UniformBinding::Object, commands.AllocateUniforms(object));
         
-        m_Shader->Unbind();
+        commands.BindVertexArray(mesh->GetVertexArray());
+        commands.DrawArrays(PrimitiveType::Triangles, 0, 3);
     }
     
     void PlanetScene::SetupTriangle() {
@@ -70,21 +86,10 @@ namespace BunnyGL {
              0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f, 1.0f
         };
         
-        glGenVertexArrays(1, &m_VAO);
-        glGenBuffers(1, &m_VBO);
-        
-        glBindVertexArray(m_VAO);
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, m_Vertices.size() * sizeof(float),m_Vertices.data(), GL_STATIC_DRAW);
-        
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-        
-        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        VertexLayout layout;
+        layout.Attributes = { { 3, 0 }, { 4, 3 * sizeof(float) } };
+        layout.Stride = 7 * sizeof(float);
+        m_Mesh = ResourceManager::Add<Mesh>("", std::make_unique<Mesh>(layout, m_Vertices.data(), 3));
         
         BG_INFO("Planet setup complete");
     }
@@ -0,0 +1,80 @@
+#include <BunnyGL/Scene/SceneRegistry.hpp>
+#include <BunnyGL/Scene/PlanetScene.hpp>
+#include <BunnyGL/Scene/TriangleScene.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace BunnyGL {
+
+    namespace {
+
+        struct Entry {
+            std::string Name;
+            SceneRegistry::Factory Create;
+        };
+
+        struct Registry {
+            std::mutex Mutex;
+            std::vector<Entry> Entries;
+
+            Registry() {
+                Entries.push_back({ "Triangle", []() -> std::unique_ptr<Scene> { return std::make_unique<TriangleScene>(); } });
+                Entries.push_back({ "Planet", []() -> std::unique_ptr<Scene> { return std::make_unique<PlanetScene>(); } });
+            }
+
+            std::vector<Entry>::iterator Find(const std::string& name) {
+                return std::find_if(Entries.begin(), Entries.end(), [&](const Entry& entry) { return entry.Name == name; });
+            }
+        };
+
+        Registry& GetRegistry() {
+            static Registry s_Registry;
+            return s_Registry;
+        }
+    }
+
+    void SceneRegistry::Register(const std::string& name, Factory factory) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        auto it = registry.Find(name);
+        if (it != registry.Entries.end()) {
+            it->Create = std::move(factory);
+        } else {
+            registry.Entries.push_back({ name, std::move(factory) });
+        }
+    }
+
+    std::vector<std::string> SceneRegistry::GetNames() {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        std::vector<std::string> names;
+        names.reserve(registry.Entries.size());
+        for (const Entry& entry : registry.Entries) {
+            names.push_back(entry.Name);
+        }
+        return names;
+    }
+
+    bool SceneRegistry::Has(const std::string& name) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        return registry.Find(name) != registry.Entries.end();
+    }
+
+    std::unique_ptr<Scene> SceneRegistry::Create(const std::string& name) {
+        Factory factory;
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            auto it = registry.Find(name);
+            if (it == registry.Entries.end()) {
+                return nullptr;
+            }
+            factory = it->Create;
+        }
+        return factory();
+    }
+
+}
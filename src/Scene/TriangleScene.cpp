@@ -1,6 +1,5 @@
 #include <BunnyGL/Scene/TriangleScene.hpp>
 #include <BunnyGL/Core/Log.hpp>
-#include <glad/glad.h>
 
 namespace BunnyGL {
 
@@ -17,51 +16,57 @@ namespace BunnyGL {
         BG_INFO("TriangleScene attached");
         
         m_Shader = ResourceManager::LoadShader("basic",
-            "resources/shaders/Basic.vert",
-            "resources/shaders/Basic.frag");
+            "resources/shaders/Colored.vert",
+            "resources/shaders/Colored.frag");
         
-        if (!m_Shader) {
+        Shader* shader = ResourceManager::Get(m_Shader);
+        if (!shader) {
             BG_ERROR("Failed to load shader!");
             return;
         }
+        m_TransformUniform = shader->GetUniformHandle("u_Transform");
         
+        PipelineDescription pipeline;
+        pipeline.Program = shader;
+        m_Pipeline = PipelineState(pipeline);
+
         SetupTriangle();
     }
     
     void TriangleScene::OnDetach() {
         BG_INFO("TriangleScene detached");
         
-        if (m_VAO) glDeleteVertexArrays(1, &m_VAO);
-        if (m_VBO) glDeleteBuffers(1, &m_VBO);
-        m_VAO = m_VBO = 0;
+        ResourceManager::Destroy(m_Mesh);
+        m_Mesh = {};
     }
     
     void TriangleScene::OnUpdate(float deltaTime) {
+        m_PreviousRotationAngle = m_RotationAngle;
         m_RotationAngle += 90.0f * deltaTime;
         if (m_RotationAngle > 360.0f) {
             m_RotationAngle -= 360.0f;
+            m_PreviousRotationAngle -= 360.0f;
         }
     }
     
-    void TriangleScene::OnRender() {
-        if (!m_Shader) return;
+    void TriangleScene::OnRender(CommandList& commands, float alpha) {
+        Mesh* mesh = ResourceManager::Get(m_Mesh);
+        if (!mesh) return;
         
-        m_Shader->Bind();
+        commands.BindPipeline(&m_Pipeline);
         
-        float angleRadians = glm::radians(m_RotationAngle);
+        float angle = m_PreviousRotationAngle + (m_RotationAngle - m_PreviousRotationAngle) * alpha;
+        float angleRadians = glm::radians(angle);
         glm::mat4 transform = glm::rotate(
             glm::mat4(1.0f), 
             angleRadians, 
             glm::vec3(0.0f, 0.0f, 1.0f)
         );
         
-        m_Shader->SetUniformMat4f("u_Transform", transform);
-        
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-        glBindVertexArray(0);
+        commands.SetUniform(m_TransformUniform, transform);
         
-        m_Shader->Unbind();
+        commands.BindVertexArray(mesh->GetVertexArray());
+        commands.DrawArrays(PrimitiveType::Triangles, 0, 3);
     }
     
     void TriangleScene::SetupTriangle() {
@@ -71,21 +76,10 @@ namespace BunnyGL {
              0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f, 1.0f
         };
         
-        glGenVertexArrays(1, &m_VAO);
-        glGenBuffers(1, &m_VBO);
-        
-        glBindVertexArray(m_VAO);
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, m_Vertices.size() * sizeof(float),m_Vertices.data(), GL_STATIC_DRAW);
-        
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-        
-        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        VertexLayout layout;
+        layout.Attributes = { { 3, 0 }, { 4, 3 * sizeof(float) } };
+        layout.Stride = 7 * sizeof(float);
+        m_Mesh = ResourceManager::Add<Mesh>("", std::make_unique<Mesh>(layout, m_Vertices.data(), 3));
         
         BG_INFO("Triangle setup complete");
     }
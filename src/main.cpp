@@ -1,14 +1,45 @@
 #include <BunnyGL/Core/Log.hpp>
 #include <BunnyGL/Core/Application.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
 #include <BunnyGL/Scene/TriangleScene.hpp>
 #include <BunnyGL/Scene/PlanetScene.hpp>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 
-int main() {
+// Usage: BunnyGL [--headless] [--frames N] [--render-thread] [--hot-reload]
+//   --headless       render offscreen without a display (EGL surfaceless, e.g. llvmpipe)
+//   --frames N       exit after N frames
+//   --render-thread  replay GL commands on a dedicated thread
+//   --hot-reload     recompile shaders when their files change
+int main(int argc, char** argv) {
     BG_INFO("Triangle Demo Starting");
+
+    BunnyGL::ApplicationSpecification spec;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            spec.Window.Headless = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            spec.MaxFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--render-thread") == 0) {
+            spec.UseRenderThread = true;
+        } else if (std::strcmp(argv[i], "--hot-reload") == 0) {
+            spec.ShaderHotReload = true;
+        } else {
+            BG_WARN("Ignoring unknown argument ", argv[i]);
+        }
+    }
+
+    // BUNNYGL_TRACE=trace.json captures setup plus the first 300 frames
+    if (const char* tracePath = std::getenv("BUNNYGL_TRACE")) {
+        BunnyGL::Profiler::SetCapture(0, 300, tracePath);
+    }
     
     // Create application
-    BunnyGL::Application app;
+    BunnyGL::Application app(spec);
+    if (!app.IsHeadless()) {
+        app.SetTargetFPS(60.0f);
+    }
     
     // Create and set scene
     auto scene = std::make_unique<BunnyGL::PlanetScene>();
@@ -21,6 +52,10 @@ int main() {
     BG_INFO("Triangle Demo Ending");
     BG_INFO("  Total runtime: ", app.GetTotalTime()," seconds");
     BG_INFO("  Average FPS: ", app.GetFPS());
+
+    const auto& pacing = app.GetFramePacingStats();
+    BG_INFO("  Frame pacing error: mean ", pacing.MeanErrorMs, "ms, stddev ", pacing.StdDevErrorMs,
+            "ms, max ", pacing.MaxErrorMs, "ms, late frames ", pacing.LateFrames, "/", pacing.Frames);
     
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,428 @@
+// BunnyGL_bench: runs every registered scene for a fixed number of warm-up and
+// measured frames with a fixed simulated delta, then reports frame time
+// percentiles with a CPU/GPU split and writes them as JSON so runs can be
+// compared across commits and machines.
+//
+// Usage: BunnyGL_bench [options]
+//   --scene NAME     only run this scene (repeatable, default: all registered)
+//   --warmup N       unmeasured frames per scene (default 120)
+//   --frames N       measured frames per scene (default 1000)
+//   --delta S        simulated seconds per frame (default 1/60)
+//   --width W        render target size (default 1280x720)
+//   --height H
+//   --windowed       render to a window instead of offscreen
+//   --render-thread  replay on a dedicated render thread
+//   --label TEXT     stored in the JSON, e.g. a commit hash
+//   --output PATH    JSON output (default BunnyGL_bench.json)
+//   --list           print the registered scenes and exit
+
+#include <BunnyGL/Core/Application.hpp>
+#include <BunnyGL/Core/Log.hpp>
+#include <BunnyGL/Core/Profiler.hpp>
+#include <BunnyGL/Renderer/GpuProfiler.hpp>
+#include <BunnyGL/Renderer/RenderState.hpp>
+#include <BunnyGL/Scene/Scene.hpp>
+#include <BunnyGL/Scene/SceneRegistry.hpp>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace BunnyGL;
+
+namespace {
+
+    struct BenchConfig {
+        std::vector<std::string> Scenes;
+        uint32_t WarmupFrames = 120;
+        uint32_t MeasuredFrames = 1000;
+        double Delta = 1.0 / 60.0;
+        int Width = 1280;
+        int Height = 720;
+        bool Headless = true;
+        bool RenderThread = false;
+        std::string Label;
+        std::string OutputPath = "BunnyGL_bench.json";
+    };
+
+    struct Summary {
+        size_t Samples = 0;
+        double Min = 0.0;
+        double Median = 0.0;
+        double P95 = 0.0;
+        double P99 = 0.0;
+        double Max = 0.0;
+        double Mean = 0.0;
+    };
+
+    struct SceneResult {
+        std::string Name;
+        Summary Frame;      // Whole frame on the main thread
+        Summary Update;
+        Summary Record;     // Scene::OnRender into the command list
+        Summary Submit;     // Replay + swap, or the hand-off to the render thread
+        Summary Gpu;        // Fewer samples than frames only when GPU results were dropped
+        double WallSeconds = 0.0;
+        // Mean GL state calls per frame that went to the driver / were redundant
+        double StateCallsIssued = 0.0;
+        double StateCallsSkipped = 0.0;
+    };
+
+    // Linear interpolation between closest ranks
+    double Percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        double rank = p * static_cast<double>(sorted.size() - 1);
+        size_t lower = static_cast<size_t>(rank);
+        size_t upper = std::min(lower + 1, sorted.size() - 1);
+        double fraction = rank - static_cast<double>(lower);
+        return sorted[lower] + (sorted[upper] - sorted[lower]) * fraction;
+    }
+
+    Summary Summarize(std::vector<double> values) {
+        Summary summary;
+        summary.Samples = values.size();
+        if (values.empty()) {
+            return summary;
+        }
+        std::sort(values.begin(), values.end());
+        double sum = 0.0;
+        for (double value : values) {
+            sum += value;
+        }
+        summary.Min = values.front();
+        summary.Median = Percentile(values, 0.50);
+        summary.P95 = Percentile(values, 0.95);
+        summary.P99 = Percentile(values, 0.99);
+        summary.Max = values.back();
+        summary.Mean = sum / static_cast<double>(values.size());
+        return summary;
+    }
+
+    SceneResult RunScene(Application& app, const std::string& name, const BenchConfig& config) {
+        SceneResult result;
+        result.Name = name;
+
+        app.SetScene(SceneRegistry::Create(name));
+
+        for (uint32_t i = 0; i < config.WarmupFrames; ++i) {
+            app.Step(config.Delta);
+        }
+
+        std::vector<double> frame, update, record, submit;
+        frame.reserve(config.MeasuredFrames);
+        update.reserve(config.MeasuredFrames);
+        record.reserve(config.MeasuredFrames);
+        submit.reserve(config.MeasuredFrames);
+
+        // GPU results arrive a few frames late, several at once when the GPU
+        // catches up, and are matched by profiler frame number
+        std::unordered_map<uint32_t, double> gpuByFrame;
+        uint32_t firstFrame = 0;
+        uint32_t lastFrame = 0;
+        std::vector<GpuFrameResult> resolved;
+        GpuProfiler::DrainResults(resolved);    // Warmup frames
+        auto collectGpu = [&]() {
+            resolved.clear();
+            GpuProfiler::DrainResults(resolved);
+            for (const GpuFrameResult& result : resolved) {
+                gpuByFrame[result.Frame] = result.TimeMs;
+            }
+        };
+
+        uint64_t stateIssued = 0;
+        uint64_t stateSkipped = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < config.MeasuredFrames; ++i) {
+            app.Step(config.Delta);
+            collectGpu();
+
+            // Counters of the last frame the renderer finished
+            RenderStateStats state = RenderStateCache::GetFrameStats();
+            stateIssued += state.Issued;
+            stateSkipped += state.Skipped;
+
+            const FrameTimings& timings = app.GetLastFrameTimings();
+            if (i == 0) firstFrame = timings.Frame;
+            lastFrame = timings.Frame;
+            frame.push_back(timings.TotalMs);
+            update.push_back(timings.UpdateMs);
+            record.push_back(timings.RenderMs);
+            submit.push_back(timings.SwapMs);
+        }
+        result.WallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Drain the readback ring so the last measured frames resolve too. The
+        // render thread adds a frame of its own, so step until the last one is
+        // in (bounded: nothing resolves with profiling compiled out).
+        for (uint32_t i = 0; i < GpuProfiler::FramesInFlight * 4 && !gpuByFrame.count(lastFrame); ++i) {
+            app.Step(config.Delta);
+            collectGpu();
+        }
+
+        std::vector<double> gpu;
+        for (const auto& [frameNumber, ms] : gpuByFrame) {
+            if (frameNumber >= firstFrame && frameNumber <= lastFrame) {
+                gpu.push_back(ms);
+            }
+        }
+
+        app.SetScene(nullptr);
+
+        result.Frame = Summarize(std::move(frame));
+        result.Update = Summarize(std::move(update));
+        result.Record = Summarize(std::move(record));
+        result.Submit = Summarize(std::move(submit));
+        result.Gpu = Summarize(std::move(gpu));
+        if (config.MeasuredFrames > 0) {
+            result.StateCallsIssued = static_cast<double>(stateIssued) / config.MeasuredFrames;
+            result.StateCallsSkipped = static_cast<double>(stateSkipped) / config.MeasuredFrames;
+        }
+        return result;
+    }
+
+    std::string JsonEscape(const std::string& str) {
+        std::ostringstream ss;
+        for (char c : str) {
+            switch (c) {
+                case '"':  ss << "\\\""; break;
+                case '\\': ss << "\\\\"; break;
+                case '\n': ss << "\\n"; break;
+                case '\t': ss << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                    } else {
+                        ss << c;
+                    }
+            }
+        }
+        return ss.str();
+    }
+
+    struct GLInfo {
+        std::string Vendor;
+        std::string Renderer;
+        std::string Version;
+    };
+
+    // Needs the context, which may live on the render thread
+    GLInfo QueryGLInfo(Application& app) {
+        GLInfo info;
+        app.ExecuteOnRenderThread([&]() {
+            auto get = [](GLenum name) -> std::string {
+                const GLubyte* str = glGetString(name);
+                return str ? reinterpret_cast<const char*>(str) : "";
+            };
+            info.Vendor = get(GL_VENDOR);
+            info.Renderer = get(GL_RENDERER);
+            info.Version = get(GL_VERSION);
+        });
+        return info;
+    }
+
+    std::string CpuModel() {
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            if (line.compare(0, 10, "model name") == 0) {
+                size_t colon = line.find(':');
+                if (colon != std::string::npos && colon + 2 <= line.size()) {
+                    return line.substr(colon + 2);
+                }
+            }
+        }
+        return "";
+    }
+
+    void WriteSummary(std::ostream& os, const char* name, const Summary& summary, bool last = false) {
+        os << "        \"" << name << "\": { \"samples\": " << summary.Samples
+           << ", \"min\": " << summary.Min
+           << ", \"median\": " << summary.Median
+           << ", \"p95\": " << summary.P95
+           << ", \"p99\": " << summary.P99
+           << ", \"max\": " << summary.Max
+           << ", \"mean\": " << summary.Mean << " }" << (last ? "\n" : ",\n");
+    }
+
+    bool WriteJson(const std::string& path, const BenchConfig& config, const GLInfo& gl, const std::vector<SceneResult>& results) {
+        std::ofstream os(path);
+        if (!os.is_open()) {
+            return false;
+        }
+        os << std::setprecision(6) << std::fixed;
+
+        char timestamp[32] = {};
+        std::time_t now = std::time(nullptr);
+        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        const char* gpuTiming = !BG_ENABLE_PROFILING ? "disabled"
+                              : GpuProfiler::IsHardwareTimed() ? "timestamp-query" : "cpu-fallback";
+
+        os << "{\n";
+        os << "  \"version\": 1,\n";
+        os << "  \"label\": \"" << JsonEscape(config.Label) << "\",\n";
+        os << "  \"timestamp\": \"" << timestamp << "\",\n";
+        os << "  \"machine\": {\n";
+        os << "    \"cpu\": \"" << JsonEscape(CpuModel()) << "\",\n";
+        os << "    \"cpu_threads\": " << std::thread::hardware_concurrency() << ",\n";
+        os << "    \"gl_vendor\": \"" << JsonEscape(gl.Vendor) << "\",\n";
+        os << "    \"gl_renderer\": \"" << JsonEscape(gl.Renderer) << "\",\n";
+        os << "    \"gl_version\": \"" << JsonEscape(gl.Version) << "\"\n";
+        os << "  },\n";
+        os << "  \"config\": {\n";
+        os << "    \"warmup_frames\": " << config.WarmupFrames << ",\n";
+        os << "    \"measured_frames\": " << config.MeasuredFrames << ",\n";
+        os << "    \"delta\": " << config.Delta << ",\n";
+        os << "    \"width\": " << config.Width << ",\n";
+        os << "    \"height\": " << config.Height << ",\n";
+        os << "    \"headless\": " << (config.Headless ? "true" : "false") << ",\n";
+        os << "    \"render_thread\": " << (config.RenderThread ? "true" : "false") << ",\n";
+        os << "    \"gpu_timing\": \"" << gpuTiming << "\"\n";
+        os << "  },\n";
+        os << "  \"units\": \"ms\",\n";
+        os << "  \"scenes\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const SceneResult& result = results[i];
+            os << "    {\n";
+            os << "      \"name\": \"" << JsonEscape(result.Name) << "\",\n";
+            os << "      \"wall_seconds\": " << result.WallSeconds << ",\n";
+            os << "      \"gl_state_calls_per_frame\": { \"issued\": " << result.StateCallsIssued
+               << ", \"skipped\": " << result.StateCallsSkipped << " },\n";
+            os << "      \"stats\": {\n";
+            WriteSummary(os, "frame", result.Frame);
+            WriteSummary(os, "cpu_update", result.Update);
+            WriteSummary(os, "cpu_record", result.Record);
+            WriteSummary(os, "cpu_submit", result.Submit);
+            WriteSummary(os, "gpu", result.Gpu, true);
+            os << "      }\n";
+            os << "    }" << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n";
+        os << "}\n";
+        return os.good();
+    }
+
+    void PrintRow(const char* name, const Summary& summary) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(3)
+           << "  " << std::left << std::setw(12) << name << std::right
+           << std::setw(10) << summary.Min
+           << std::setw(10) << summary.Median
+           << std::setw(10) << summary.P95
+           << std::setw(10) << summary.P99
+           << std::setw(10) << summary.Max
+           << std::setw(10) << summary.Mean
+           << "  (" << summary.Samples << " samples)";
+        BG_RAW(ss.str());
+    }
+
+    void PrintResult(const SceneResult& result) {
+        BG_RAW("Scene '", result.Name, "' (", result.WallSeconds, "s)");
+        BG_RAW("  ms                 min    median       p95       p99       max      mean");
+        PrintRow("frame", result.Frame);
+        PrintRow("cpu update", result.Update);
+        PrintRow("cpu record", result.Record);
+        PrintRow("cpu submit", result.Submit);
+        PrintRow("gpu", result.Gpu);
+        BG_RAW("  GL state calls per frame: ", result.StateCallsIssued, " issued, ", result.StateCallsSkipped, " skipped");
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : ""; };
+        if (std::strcmp(argv[i], "--scene") == 0) {
+            config.Scenes.push_back(next());
+        } else if (std::strcmp(argv[i], "--warmup") == 0) {
+            config.WarmupFrames = static_cast<uint32_t>(std::strtoul(next(), nullptr, 10));
+        } else if (std::strcmp(argv[i], "--frames") == 0) {
+            config.MeasuredFrames = static_cast<uint32_t>(std::strtoul(next(), nullptr, 10));
+        } else if (std::strcmp(argv[i], "--delta") == 0) {
+            config.Delta = std::strtod(next(), nullptr);
+        } else if (std::strcmp(argv[i], "--width") == 0) {
+            config.Width = std::atoi(next());
+        } else if (std::strcmp(argv[i], "--height") == 0) {
+            config.Height = std::atoi(next());
+        } else if (std::strcmp(argv[i], "--windowed") == 0) {
+            config.Headless = false;
+        } else if (std::strcmp(argv[i], "--render-thread") == 0) {
+            config.RenderThread = true;
+        } else if (std::strcmp(argv[i], "--label") == 0) {
+            config.Label = next();
+        } else if (std::strcmp(argv[i], "--output") == 0) {
+            config.OutputPath = next();
+        } else if (std::strcmp(argv[i], "--list") == 0) {
+            listOnly = true;
+        } else {
+            BG_WARN("Ignoring unknown argument ", argv[i]);
+        }
+    }
+
+    if (listOnly) {
+        for (const std::string& name : SceneRegistry::GetNames()) {
+            BG_RAW(name);
+        }
+        return 0;
+    }
+
+    if (config.Scenes.empty()) {
+        config.Scenes = SceneRegistry::GetNames();
+    }
+    for (const std::string& name : config.Scenes) {
+        if (!SceneRegistry::Has(name)) {
+            BG_ERROR("Unknown scene '", name, "' (see --list)");
+            return 1;
+        }
+    }
+    if (config.MeasuredFrames == 0 || config.Delta <= 0.0) {
+        BG_ERROR("--frames and --delta must be positive");
+        return 1;
+    }
+
+    // Engine chatter would only add noise to the timings
+    Log::SetLevel(LogLevel::Warn);
+
+    ApplicationSpecification spec;
+    spec.Window.Width = config.Width;
+    spec.Window.Height = config.Height;
+    spec.Window.Title = "BunnyGL Bench";
+    spec.Window.Headless = config.Headless;
+    spec.UseRenderThread = config.RenderThread;
+
+    std::vector<SceneResult> results;
+    GLInfo gl;
+    {
+        Application app(spec);
+        gl = QueryGLInfo(app);
+        for (const std::string& name : config.Scenes) {
+            results.push_back(RunScene(app, name, config));
+            PrintResult(results.back());
+        }
+    }
+
+    if (!WriteJson(config.OutputPath, config, gl, results)) {
+        BG_ERROR("Failed to write ", config.OutputPath);
+        return 1;
+    }
+
+    BG_RAW("Results written to ", config.OutputPath);
+    return 0;
+}
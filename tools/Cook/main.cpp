@@ -0,0 +1,295 @@
+// bunnygl-cook: converts source assets into runtime-native blobs, so loading
+// them is a header check and a copy into GL (see CookedAsset):
+//   images (.tga .ppm .pgm)        -> .bgtex   decoded, with the mip chain
+//   meshes (.obj)                  -> .bgmesh  final vertex layout, 16/32-bit indices
+//   shader stages (.vert .frag ..) -> same name, includes expanded
+//   everything else                -> copied
+// The output mirrors the source tree. Rebuilds are incremental: each output is
+// recorded in <output>/.cookmanifest with a hash of its inputs and is only
+// cooked again when that changes (or with --force). Outputs whose source has
+// gone are deleted. Files are cooked in parallel on the JobSystem.
+//
+// Usage: bunnygl-cook <source dir> <output dir> [options]
+//   --threads N    worker threads besides the main one (default: hardware threads - 1)
+//   --force        cook everything
+//   --no-mips      textures get only their base level
+
+#include <BunnyGL/Core/Hash.hpp>
+#include <BunnyGL/Core/JobSystem.hpp>
+#include <BunnyGL/Renderer/ShaderPreprocessor.hpp>
+#include <BunnyGL/Resources/AssetDecoder.hpp>
+#include <BunnyGL/Resources/CookedAsset.hpp>
+#include <BunnyGL/Resources/FileSystem.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace BunnyGL;
+
+namespace {
+
+    namespace fs = std::filesystem;
+
+    // Bump when a cook function's output changes, so old outputs are redone
+    constexpr uint32_t CookerVersion = 1;
+    constexpr const char* ManifestName = ".cookmanifest";
+
+    enum class AssetKind { Texture, Mesh, Shader, Copy };
+
+    struct CookJob {
+        std::string Source;         // Relative to the source directory
+        std::string Output;         // Relative to the output directory
+        AssetKind Kind = AssetKind::Copy;
+        uint64_t Key = 0;           // Hash of everything the output depends on
+        bool Cooked = false;
+        bool Failed = false;
+    };
+
+    struct Options {
+        fs::path SourceDirectory;
+        fs::path OutputDirectory;
+        uint32_t Threads = 0;
+        bool Force = false;
+        bool Mipmaps = true;
+    };
+
+    AssetKind KindOf(std::string_view extension) {
+        if (AssetDecoder::IsImageExtension(extension)) return AssetKind::Texture;
+        if (AssetDecoder::IsMeshExtension(extension)) return AssetKind::Mesh;
+        if (extension == "vert" || extension == "frag" || extension == "geom" || extension == "comp" ||
+            extension == "tesc" || extension == "tese") {
+            return AssetKind::Shader;
+        }
+        return AssetKind::Copy;
+    }
+
+    std::string OutputPathOf(const std::string& source, AssetKind kind) {
+        std::string_view extension = FileSystem::GetExtension(source);
+        std::string stem = source.substr(0, source.size() - extension.size());
+        switch (kind) {
+            case AssetKind::Texture: return stem + "bgtex";
+            case AssetKind::Mesh:    return stem + "bgmesh";
+            default:                 return source;
+        }
+    }
+
+    uint64_t Combine(uint64_t hash, uint64_t value) {
+        return Hash64Of(value, hash);
+    }
+
+    // Manifest lines: <key hex> <source> <output>, tab separated
+    std::unordered_map<std::string, std::pair<uint64_t, std::string>> ReadManifest(const fs::path& path) {
+        std::unordered_map<std::string, std::pair<uint64_t, std::string>> entries;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            size_t first = line.find('\t');
+            size_t second = first == std::string::npos ? first : line.find('\t', first + 1);
+            if (second == std::string::npos) continue;
+            uint64_t key = std::strtoull(line.substr(0, first).c_str(), nullptr, 16);
+            entries[line.substr(first + 1, second - first - 1)] = { key, line.substr(second + 1) };
+        }
+        return entries;
+    }
+
+    bool WriteOutput(const fs::path& path, std::string_view data, std::string& error) {
+        std::error_code ec;
+        fs::create_directories(path.parent_path(), ec);
+        fs::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!file.good()) {
+                error = "cannot write " + temporary.string();
+                return false;
+            }
+        }
+        fs::rename(temporary, path, ec);
+        if (ec) {
+            error = "cannot replace " + path.string() + ": " + ec.message();
+            fs::remove(temporary, ec);
+            return false;
+        }
+        return true;
+    }
+
+    // Reads the inputs, computes the key and, if it changed, cooks and writes
+    // the output. Runs on any JobSystem thread.
+    void Cook(CookJob& job, const Options& options, const std::unordered_map<std::string, std::pair<uint64_t, std::string>>& manifest) {
+        std::string sourcePath = (options.SourceDirectory / job.Source).generic_string();
+        std::string error;
+        std::string source;
+        PreprocessedShader shader;
+
+        uint64_t key = Combine(CookerVersion, static_cast<uint64_t>(job.Kind));
+        if (job.Kind == AssetKind::Shader) {
+            // Preprocessing is the cook; keying on its output covers the includes
+            shader = ShaderPreprocessor::Process(sourcePath);
+            if (!shader.Success) {
+                std::cerr << "bunnygl-cook: " << job.Source << ": preprocessing failed\n";
+                job.Failed = true;
+                return;
+            }
+            key = Combine(key, shader.Hash);
+        } else {
+            if (!FileSystem::ReadInto(sourcePath, source)) {
+                std::cerr << "bunnygl-cook: cannot read " << job.Source << "\n";
+                job.Failed = true;
+                return;
+            }
+            key = Combine(key, Hash64(source));
+            if (job.Kind == AssetKind::Texture) {
+                key = Combine(key, CookedAsset::Version * 2 + (options.Mipmaps ? 1 : 0));
+            } else if (job.Kind == AssetKind::Mesh) {
+                key = Combine(key, CookedAsset::Version);
+            }
+        }
+        job.Key = key;
+
+        fs::path outputPath = options.OutputDirectory / job.Output;
+        auto previous = manifest.find(job.Source);
+        if (!options.Force && previous != manifest.end() && previous->second.first == key &&
+            previous->second.second == job.Output && FileSystem::FileExists(outputPath.string())) {
+            return;
+        }
+
+        std::string cooked;
+        switch (job.Kind) {
+            case AssetKind::Texture: {
+                ImageData image;
+                if (!AssetDecoder::DecodeImage(source, image, error)) break;
+                cooked = CookedAsset::CookTexture(image, options.Mipmaps);
+                break;
+            }
+            case AssetKind::Mesh: {
+                MeshData mesh;
+                if (!AssetDecoder::DecodeMesh(source, mesh, error)) break;
+                cooked = CookedAsset::CookMesh(mesh);
+                break;
+            }
+            case AssetKind::Shader:
+                cooked = std::move(shader.Source);
+                break;
+            case AssetKind::Copy:
+                cooked = std::move(source);
+                break;
+        }
+
+        if (!error.empty() || !WriteOutput(outputPath, cooked, error)) {
+            std::cerr << "bunnygl-cook: " << job.Source << ": " << error << "\n";
+            job.Failed = true;
+            return;
+        }
+        job.Cooked = true;
+    }
+
+    bool ParseArguments(int argc, char** argv, Options& options) {
+        if (argc < 3) {
+            return false;
+        }
+        options.SourceDirectory = argv[1];
+        options.OutputDirectory = argv[2];
+        for (int i = 3; i < argc; i++) {
+            if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+                options.Threads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "--force") == 0) {
+                options.Force = true;
+            } else if (std::strcmp(argv[i], "--no-mips") == 0) {
+                options.Mipmaps = false;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseArguments(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0] << " <source dir> <output dir> [--threads N] [--force] [--no-mips]\n";
+        return 1;
+    }
+    // Cook what is on disk, not the copies embedded when the tool was built
+    FileSystem::SetUseEmbedded(false);
+
+    std::vector<CookJob> jobs;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(options.SourceDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        CookJob job;
+        job.Source = it->path().lexically_relative(options.SourceDirectory).generic_string();
+        job.Kind = KindOf(FileSystem::GetExtension(job.Source));
+        job.Output = OutputPathOf(job.Source, job.Kind);
+        jobs.push_back(std::move(job));
+    }
+    if (ec) {
+        std::cerr << "bunnygl-cook: cannot list " << options.SourceDirectory.string() << ": " << ec.message() << "\n";
+        return 1;
+    }
+
+    std::sort(jobs.begin(), jobs.end(), [](const CookJob& a, const CookJob& b) { return a.Source < b.Source; });
+
+    // brick.tga and brick.ppm would both become brick.bgtex
+    std::unordered_map<std::string, std::string> outputs;
+    for (CookJob& job : jobs) {
+        auto [it, added] = outputs.emplace(job.Output, job.Source);
+        if (!added) {
+            std::cerr << "bunnygl-cook: " << job.Source << " and " << it->second << " both cook to " << job.Output << "\n";
+            job.Failed = true;
+        }
+    }
+
+    fs::path manifestPath = options.OutputDirectory / ManifestName;
+    auto manifest = ReadManifest(manifestPath);
+
+    {
+        JobSystem jobSystem(options.Threads);
+        // One file per job: sizes vary far too much for batching to help
+        jobSystem.ParallelFor(static_cast<uint32_t>(jobs.size()), 1, [&](uint32_t i) {
+            if (!jobs[i].Failed) Cook(jobs[i], options, manifest);
+        });
+    }
+
+    // Outputs of sources that no longer exist
+    size_t removed = 0;
+    for (const auto& [source, entry] : manifest) {
+        if (!outputs.count(entry.second) && fs::remove(options.OutputDirectory / entry.second, ec)) {
+            removed++;
+        }
+    }
+
+    size_t cooked = 0;
+    size_t failed = 0;
+    std::ostringstream manifestText;
+    for (const CookJob& job : jobs) {
+        cooked += job.Cooked ? 1 : 0;
+        failed += job.Failed ? 1 : 0;
+        // Failed jobs are left out, so the next run tries them again
+        if (!job.Failed) {
+            char key[17];
+            std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(job.Key));
+            manifestText << key << '\t' << job.Source << '\t' << job.Output << '\n';
+        }
+    }
+    std::string error;
+    fs::create_directories(options.OutputDirectory, ec);
+    if (!WriteOutput(manifestPath, manifestText.str(), error)) {
+        std::cerr << "bunnygl-cook: " << error << "\n";
+        return 1;
+    }
+
+    std::cout << "bunnygl-cook: " << cooked << " cooked, " << jobs.size() - cooked - failed << " up to date, "
+              << removed << " removed, " << failed << " failed\n";
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+// bunnygl-logdecode: turns a binary log (LogConfig::BinaryFilePath) back into
+// the regular "[HH:MM:SS][LEVEL][file] message" text.
+//
+// Usage: bunnygl-logdecode <file.bglog> [--no-color]
+
+#include <BunnyGL/Core/LogBinarySink.hpp>
+#include <BunnyGL/Core/LogFormatter.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace BunnyGL;
+
+namespace {
+
+    struct Site {
+        std::string File;
+        uint32_t Line;
+        LogLevel Level;
+        LogCategory Category;
+        std::vector<std::string> Literals;
+    };
+
+    class Reader {
+    private:
+        const std::vector<uint8_t>& m_Data;
+        size_t m_Pos;
+
+    public:
+        Reader(const std::vector<uint8_t>& data, size_t pos) : m_Data(data), m_Pos(pos) {}
+
+        bool Has(size_t bytes) const { return m_Pos + bytes <= m_Data.size(); }
+        bool AtEnd() const { return m_Pos >= m_Data.size(); }
+        const uint8_t* Current() const { return m_Data.data() + m_Pos; }
+        void Skip(size_t bytes) { m_Pos += bytes; }
+
+        bool ReadString(std::string& out) {
+            uint16_t length;
+            if (!Read(length) || !Has(length)) return false;
+            out.assign(reinterpret_cast<const char*>(Current()), length);
+            m_Pos += length;
+            return true;
+        }
+
+        template<typename T>
+        bool Read(T& out) {
+            if (!Has(sizeof(T))) return false;
+            std::memcpy(&out, m_Data.data() + m_Pos, sizeof(T));
+            m_Pos += sizeof(T);
+            return true;
+        }
+    };
+
+    // Turns the file's site literal indices back into strings. The result can
+    // be far larger than the payload was, so it goes into a growable buffer.
+    // False on a corrupt payload.
+    bool ExpandLiterals(const Site& site, const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+        out.clear();
+        for (size_t pos = 0; pos < size;) {
+            LogArgType type = static_cast<LogArgType>(data[pos++]);
+            if (type == LogArgType::String && pos + sizeof(uint16_t) > size) return false;
+            size_t argSize = pos < size ? GetLogArgSize(type, data + pos) : 0;
+            if (argSize == 0 || pos + argSize > size) return false;
+
+            if (type == LogArgType::SiteLiteral) {
+                if (data[pos] >= site.Literals.size()) return false;
+                const std::string& text = site.Literals[data[pos]];
+                uint16_t length = static_cast<uint16_t>(text.size());
+                out.push_back(static_cast<uint8_t>(LogArgType::String));
+                out.insert(out.end(), reinterpret_cast<const uint8_t*>(&length), reinterpret_cast<const uint8_t*>(&length) + sizeof(length));
+                out.insert(out.end(), text.begin(), text.begin() + length);
+            } else {
+                out.push_back(static_cast<uint8_t>(type));
+                out.insert(out.end(), data + pos, data + pos + argSize);
+            }
+            pos += argSize;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file.bglog> [--no-color]\n";
+        return 1;
+    }
+
+    bool color = !(argc > 2 && std::strcmp(argv[2], "--no-color") == 0);
+
+    std::ifstream file(argv[1], std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    LogBinaryFormat::FileHeader header{};
+    if (data.size() < sizeof(header)) {
+        std::cerr << argv[1] << " is not a BunnyGL binary log\n";
+        return 1;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.Magic, LogBinaryFormat::Magic, sizeof(header.Magic)) != 0) {
+        std::cerr << argv[1] << " is not a BunnyGL binary log\n";
+        return 1;
+    }
+    if (header.Version != LogBinaryFormat::Version) {
+        std::cerr << "Unsupported binary log version " << header.Version << "\n";
+        return 1;
+    }
+
+    std::vector<Site> sites;
+    LogFormatter formatter;
+    std::ostream* colored = color ? &std::cout : nullptr;
+    std::ostream* plain = color ? nullptr : &std::cout;
+    size_t events = 0;
+    size_t skipped = 0;
+    std::vector<uint8_t> payload;
+
+    Reader reader(data, sizeof(header));
+    while (!reader.AtEnd()) {
+        LogBinaryFormat::ChunkType type;
+        if (!reader.Read(type)) {
+            break;
+        }
+
+        if (type == LogBinaryFormat::ChunkType::End) {
+            break;
+        }
+
+        if (type == LogBinaryFormat::ChunkType::Site) {
+            uint32_t id, line;
+            uint8_t level, category;
+            uint8_t literalCount;
+            Site site;
+            bool valid = reader.Read(id) && reader.Read(line) && reader.Read(level) && reader.Read(category) &&
+                         reader.ReadString(site.File) && reader.Read(literalCount);
+            site.Literals.resize(valid ? literalCount : 0);
+            for (std::string& literal : site.Literals) {
+                valid = valid && reader.ReadString(literal);
+            }
+            if (!valid) {
+                std::cerr << "Truncated site definition\n";
+                return 1;
+            }
+            site.Line = line;
+            site.Level = static_cast<LogLevel>(level);
+            site.Category = static_cast<LogCategory>(category);
+            if (id >= sites.size()) sites.resize(id + 1);
+            sites[id] = std::move(site);
+        } else if (type == LogBinaryFormat::ChunkType::Event) {
+            LogRecord record{};
+            uint32_t siteId;
+            uint8_t truncated;
+            uint16_t size;
+            if (!reader.Read(siteId) || !reader.Read(record.Timestamp) || !reader.Read(truncated) ||
+                !reader.Read(size) || !reader.Has(size)) {
+                std::cerr << "Truncated event record\n";
+                return 1;
+            }
+            // The chunk's size is known, so one bad event doesn't cost the rest
+            if (siteId >= sites.size() || !ExpandLiterals(sites[siteId], reader.Current(), size, payload)) {
+                std::cerr << "Skipping corrupt event record (site " << siteId << ")\n";
+                reader.Skip(size);
+                skipped++;
+                continue;
+            }
+            const Site& site = sites[siteId];
+            record.File = site.File.c_str();
+            record.Line = site.Line;
+            record.Level = site.Level;
+            record.Category = site.Category;
+            record.Truncated = truncated != 0;
+            reader.Skip(size);
+
+            formatter.Write(record, payload.data(), payload.size(), colored, plain);
+            events++;
+        } else if (type == LogBinaryFormat::ChunkType::Dropped) {
+            uint64_t count;
+            if (!reader.Read(count)) {
+                std::cerr << "Truncated dropped-count record\n";
+                return 1;
+            }
+            std::cout << "[LOG] Dropped " << count << " messages (ring buffer full)\n";
+        } else {
+            std::cerr << "Unknown chunk type " << static_cast<int>(type) << "\n";
+            return 1;
+        }
+    }
+
+    std::cerr << "Decoded " << events << " events from " << sites.size() << " log sites";
+    if (skipped > 0) {
+        std::cerr << ", skipped " << skipped << " corrupt events";
+    }
+    std::cerr << "\n";
+    return 0;
+}
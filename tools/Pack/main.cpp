@@ -0,0 +1,54 @@
+// bunnygl-pack: packs a directory into a PackArchive (.bgpak), or lists and
+// verifies an existing one. Run from the repo root so entry paths match what
+// the engine loads ("resources/shaders/Planet.vert").
+//
+// Usage: bunnygl-pack <output.bgpak> <directory> [--align N]
+//        bunnygl-pack --list <archive.bgpak>
+
+#include <BunnyGL/Resources/FileSystem.hpp>
+#include <BunnyGL/Resources/PackArchive.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace BunnyGL;
+
+namespace {
+
+    int List(const char* path) {
+        PackArchive archive;
+        if (!archive.Open(path)) {
+            std::cerr << "Cannot open " << path << "\n";
+            return 1;
+        }
+        for (uint32_t i = 0; i < archive.GetEntryCount(); i++) {
+            const PackEntry& entry = archive.GetEntry(i);
+            std::cout << archive.GetEntryPath(entry) << "  " << entry.Size << " bytes @ " << entry.DataOffset << "\n";
+        }
+        return archive.VerifyAll() ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && std::strcmp(argv[1], "--list") == 0) {
+        return List(argv[2]);
+    }
+    if (argc != 3 && !(argc == 5 && std::strcmp(argv[3], "--align") == 0)) {
+        std::cerr << "Usage: " << argv[0] << " <output.bgpak> <directory> [--align N]\n"
+                  << "       " << argv[0] << " --list <archive.bgpak>\n";
+        return 1;
+    }
+
+    // Pack what is on disk now, not the copies embedded when the tool was built
+    FileSystem::SetUseEmbedded(false);
+
+    uint32_t alignment = argc == 5 ? static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10)) : PackArchive::DefaultAlignment;
+    std::string error;
+    if (!PackArchive::Build(argv[2], argv[1], error, alignment)) {
+        std::cerr << "bunnygl-pack: " << error << "\n";
+        return 1;
+    }
+    return 0;
+}